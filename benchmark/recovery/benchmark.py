@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+
+import argparse
+import os
+import shutil
+import timeit
+from multiprocessing import Process
+
+import kuzu
+
+NUM_TABLES = 4
+BATCH_SIZE = 1000000
+
+
+def write_wal(db_path, num_nodes):
+    db = kuzu.Database(db_path, auto_checkpoint=False)
+    con = kuzu.Connection(db)
+    for t in range(NUM_TABLES):
+        con.execute(
+            f"CREATE NODE TABLE node{t}(id INT64, val INT64, name STRING, PRIMARY KEY(id));")
+        con.execute(f"CREATE REL TABLE edge{t}(FROM node{t} TO node{t}, weight DOUBLE);")
+    for start in range(0, num_nodes, BATCH_SIZE):
+        end = min(start + BATCH_SIZE, num_nodes) - 1
+        # Interleave the tables within each transaction.
+        con.execute("BEGIN TRANSACTION;")
+        for t in range(NUM_TABLES):
+            con.execute(
+                f"UNWIND range({start}, {end}) AS i "
+                f"CREATE (:node{t} {{id: i, val: i, name: concat('name', CAST(i AS STRING))}});")
+        con.execute("COMMIT;")
+    for t in range(NUM_TABLES):
+        con.execute(
+            f"MATCH (a:node{t}), (b:node{t}) WHERE b.id = a.id + 1 "
+            f"CREATE (a)-[:edge{t} {{weight: a.id * 0.5}}]->(b);")
+        con.execute(f"MATCH (a:node{t}) WHERE a.id % 10 = 0 SET a.val = -a.val;")
+    # Exit without closing the database, so that the WAL is not checkpointed.
+    os._exit(0)
+
+
+def recover(db_path, num_threads):
+    start = timeit.default_timer()
+    db = kuzu.Database(db_path, max_num_threads=num_threads)
+    end = timeit.default_timer()
+    con = kuzu.Connection(db)
+    count = con.execute("MATCH (a:node0) RETURN COUNT(*);").get_next()[0]
+    return end - start, count
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--db-path", default="recovery_db")
+    parser.add_argument("--num-nodes", type=int, default=20000000)
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 2, 4, 8])
+    args = parser.parse_args()
+
+    if os.path.exists(args.db_path):
+        os.remove(args.db_path)
+    writer = Process(target=write_wal, args=(args.db_path, args.num_nodes))
+    writer.start()
+    writer.join()
+    wal_path = args.db_path + ".wal"
+    print(f"WAL size: {os.path.getsize(wal_path) / (1 << 30):.2f} GB")
+
+    run_path = args.db_path + "_run"
+    for num_threads in args.threads:
+        shutil.copyfile(args.db_path, run_path)
+        shutil.copyfile(wal_path, run_path + ".wal")
+        elapsed, count = recover(run_path, num_threads)
+        print(f"threads={num_threads}: recovered {count} nodes of node0 in {elapsed:.2f}s")
+        for path in (run_path, run_path + ".wal"):
+            if os.path.exists(path):
+                os.remove(path)
+
+
+if __name__ == "__main__":
+    main()
@@ -184,11 +184,26 @@ QFTSOutputWriter::QFTSOutputWriter(const node_id_map_t<ScoreInfo>& scores, Memor
     : scores{scores}, mm{mm}, config{config}, bindData{bindData}, numUniqueTerms{numUniqueTerms},
       sharedState{sharedState}, scoreFtInsertState{} {}
 
-void QFTSOutputWriter::write(processor::FactorizedTable& scoreFT, nodeID_t docNodeID, uint64_t len,
-    int64_t docsID) {
+static double getTermScore(const QueryFTSConfig& config, const QueryFTSBindData& bindData,
+    uint64_t df, uint64_t tf, uint64_t len) {
     auto k = config.k;
     auto b = config.b;
+    auto numDocs = bindData.numDocs;
+    auto avgDocLen = bindData.avgDocLen;
+    return log10((numDocs - df + 0.5) / (df + 0.5) + 1) *
+           ((tf * (k + 1) / (tf + k * (1 - b + b * (len / avgDocLen)))));
+}
+
+// Upper bound of the score a term contributes to any document. The term frequency part of BM25
+// saturates at k + 1.
+static double getMaxTermScore(const QueryFTSConfig& config, const QueryFTSBindData& bindData,
+    uint64_t df) {
+    auto numDocs = bindData.numDocs;
+    return log10((numDocs - df + 0.5) / (df + 0.5) + 1) * (config.k + 1);
+}
 
+void QFTSOutputWriter::write(processor::FactorizedTable& scoreFT, nodeID_t docNodeID, uint64_t len,
+    int64_t docsID) {
     if (!scores.contains(docNodeID)) {
         return;
     }
@@ -199,14 +214,8 @@ void QFTSOutputWriter::write(processor::FactorizedTable& scoreFT, nodeID_t docNo
     if (config.isConjunctive && scoreInfo.scoreData.size() != numUniqueTerms) {
         return;
     }
-    auto auxInfo = bindData.entry.getAuxInfo().cast<FTSIndexAuxInfo>();
     for (auto& scoreData : scoreInfo.scoreData) {
-        auto numDocs = bindData.numDocs;
-        auto avgDocLen = bindData.avgDocLen;
-        auto df = scoreData.df;
-        auto tf = scoreData.tf;
-        score += log10((numDocs - df + 0.5) / (df + 0.5) + 1) *
-                 ((tf * (k + 1) / (tf + k * (1 - b + b * (len / avgDocLen)))));
+        score += getTermScore(config, bindData, scoreData.df, scoreData.tf, len);
     }
     sharedState.addDocScore(scoreFtInsertState.vectors, scoreFT, {(uint64_t)docsID, score});
 }
@@ -305,6 +314,219 @@ static void initFrontier(FrontierPair& frontierPair, table_id_t termsTableID,
     }
 }
 
+struct QFTSTermInfo {
+    offset_t offset;
+    uint64_t df;
+    double maxScore;
+};
+
+struct QFTSCandidate {
+    uint64_t len;
+    int64_t docID;
+    double score;
+    uint64_t numTerms;
+};
+
+// Evaluates a top-k query with MaxScore pruning. Terms are processed in decreasing order of their
+// score upper bound. Once the upper bounds of the remaining terms add up to less than the k-th best
+// partial score, a document that has not been seen yet cannot enter the top-k. The remaining
+// postings are then only probed for the current candidates, which are dropped as soon as they
+// cannot reach the k-th best score anymore.
+class QFTSTopKEvaluator {
+public:
+    QFTSTopKEvaluator(graph::Graph* graph, const QueryFTSBindData& bindData,
+        table_id_t termsTableID, const std::unordered_map<offset_t, uint64_t>& dfs);
+
+    void evaluate(uint64_t numUniqueTerms, MemoryManager* mm, QFTSSharedState& sharedState);
+
+private:
+    void scanPostings(const QFTSTermInfo& term, bool addCandidates);
+    void probeCandidates(std::span<const QFTSTermInfo> terms);
+    void addPosting(nodeID_t docNodeID, uint64_t df, uint64_t tf, bool addCandidates);
+    double getKthBestScore() const;
+    void pruneCandidates(double threshold, double remainingMaxScore);
+
+private:
+    graph::Graph* graph;
+    const QueryFTSBindData& bindData;
+    QueryFTSConfig config;
+    table_id_t termsTableID;
+    table_id_t docsTableID;
+    std::unique_ptr<graph::NbrScanState> fwdScanState;
+    std::unique_ptr<graph::NbrScanState> bwdScanState;
+    std::unique_ptr<graph::VertexScanState> docScanState;
+    std::vector<QFTSTermInfo> terms;
+    std::unordered_map<offset_t, QFTSCandidate> candidates;
+};
+
+QFTSTopKEvaluator::QFTSTopKEvaluator(graph::Graph* graph, const QueryFTSBindData& bindData,
+    table_id_t termsTableID, const std::unordered_map<offset_t, uint64_t>& dfs)
+    : graph{graph}, bindData{bindData}, config{bindData.getConfig()}, termsTableID{termsTableID} {
+    auto graphEntry = graph->getGraphEntry();
+    auto docsEntry = graphEntry->nodeInfos[1].entry;
+    docsTableID = docsEntry->getTableID();
+    auto relInfos = graph->getRelInfos(termsTableID);
+    KU_ASSERT(relInfos.size() == 1);
+    auto& relInfo = relInfos[0];
+    fwdScanState = graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID, docsTableID,
+        {TERM_FREQUENCY_PROP_NAME});
+    bwdScanState = graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+        termsTableID, {TERM_FREQUENCY_PROP_NAME});
+    docScanState = graph->prepareVertexScan(docsEntry, {DOC_LEN_PROP_NAME, DOC_ID_PROP_NAME});
+    for (auto& [offset, df] : dfs) {
+        terms.push_back({offset, df, getMaxTermScore(config, bindData, df)});
+    }
+    std::sort(terms.begin(), terms.end(),
+        [](const auto& left, const auto& right) { return left.maxScore > right.maxScore; });
+}
+
+void QFTSTopKEvaluator::addPosting(nodeID_t docNodeID, uint64_t df, uint64_t tf,
+    bool addCandidates) {
+    auto it = candidates.find(docNodeID.offset);
+    if (it == candidates.end()) {
+        if (!addCandidates) {
+            return;
+        }
+        QFTSCandidate candidate{0, 0, 0, 0};
+        for (auto chunk :
+            graph->scanVertices(docNodeID.offset, docNodeID.offset + 1, *docScanState)) {
+            KU_ASSERT(chunk.size() == 1);
+            candidate.len = chunk.getProperties<uint64_t>(0)[0];
+            candidate.docID = chunk.getProperties<int64_t>(1)[0];
+        }
+        it = candidates.emplace(docNodeID.offset, candidate).first;
+    }
+    it->second.score += getTermScore(config, bindData, df, tf, it->second.len);
+    it->second.numTerms++;
+}
+
+void QFTSTopKEvaluator::scanPostings(const QFTSTermInfo& term, bool addCandidates) {
+    for (auto chunk : graph->scanFwd(nodeID_t{term.offset, termsTableID}, *fwdScanState)) {
+        chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+            auto tf = propertyVectors[0]->template getValue<uint64_t>(i);
+            addPosting(neighbors[i], term.df, tf, addCandidates);
+        });
+    }
+}
+
+void QFTSTopKEvaluator::probeCandidates(std::span<const QFTSTermInfo> termsToProbe) {
+    // Probing through the terms of each candidate document is cheaper than scanning the postings
+    // if the candidates are short compared to the posting lists.
+    uint64_t postingsCost = 0;
+    for (auto& term : termsToProbe) {
+        postingsCost += term.df;
+    }
+    uint64_t candidatesCost = 0;
+    for (auto& [_, candidate] : candidates) {
+        candidatesCost += candidate.len;
+    }
+    if (postingsCost <= candidatesCost) {
+        for (auto& term : termsToProbe) {
+            scanPostings(term, false /* addCandidates */);
+        }
+        return;
+    }
+    std::unordered_map<offset_t, uint64_t> dfsToProbe;
+    for (auto& term : termsToProbe) {
+        dfsToProbe.emplace(term.offset, term.df);
+    }
+    for (auto& [docOffset, _] : candidates) {
+        auto docNodeID = nodeID_t{docOffset, docsTableID};
+        for (auto chunk : graph->scanBwd(docNodeID, *bwdScanState)) {
+            chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+                if (!dfsToProbe.contains(neighbors[i].offset)) {
+                    return;
+                }
+                auto tf = propertyVectors[0]->template getValue<uint64_t>(i);
+                addPosting(docNodeID, dfsToProbe.at(neighbors[i].offset), tf,
+                    false /* addCandidates */);
+            });
+        }
+    }
+}
+
+double QFTSTopKEvaluator::getKthBestScore() const {
+    if (candidates.size() < config.topK) {
+        return 0;
+    }
+    std::vector<double> scores;
+    scores.reserve(candidates.size());
+    for (auto& [_, candidate] : candidates) {
+        scores.push_back(candidate.score);
+    }
+    auto kth = scores.begin() + (config.topK - 1);
+    std::nth_element(scores.begin(), kth, scores.end(), std::greater<>());
+    return *kth;
+}
+
+void QFTSTopKEvaluator::pruneCandidates(double threshold, double remainingMaxScore) {
+    std::erase_if(candidates, [&](const auto& entry) {
+        return entry.second.score + remainingMaxScore < threshold;
+    });
+}
+
+void QFTSTopKEvaluator::evaluate(uint64_t numUniqueTerms, MemoryManager* mm,
+    QFTSSharedState& sharedState) {
+    if (terms.empty()) {
+        return;
+    }
+    if (config.isConjunctive) {
+        // A document has to contain all terms, so only the postings of the term with the fewest
+        // documents are scanned.
+        if (terms.size() != numUniqueTerms) {
+            return;
+        }
+        scanPostings(terms[0], true /* addCandidates */);
+        probeCandidates(std::span{terms}.subspan(1));
+    } else {
+        std::vector<double> remainingMaxScores(terms.size() + 1, 0);
+        for (auto i = terms.size(); i > 0; i--) {
+            remainingMaxScores[i - 1] = remainingMaxScores[i] + terms[i - 1].maxScore;
+        }
+        auto numEssentialTerms = terms.size();
+        for (auto i = 0u; i < terms.size(); i++) {
+            scanPostings(terms[i], true /* addCandidates */);
+            auto threshold = getKthBestScore();
+            if (threshold > 0 && remainingMaxScores[i + 1] < threshold) {
+                numEssentialTerms = i + 1;
+                pruneCandidates(threshold, remainingMaxScores[i + 1]);
+                break;
+            }
+        }
+        if (numEssentialTerms < terms.size()) {
+            probeCandidates(std::span{terms}.subspan(numEssentialTerms));
+        }
+    }
+    ScoreFTInsertState insertState;
+    auto localTable = sharedState.factorizedTablePool.claimLocalTable(mm);
+    for (auto& [_, candidate] : candidates) {
+        if (config.isConjunctive && candidate.numTerms != numUniqueTerms) {
+            continue;
+        }
+        sharedState.addDocScore(insertState.vectors, *localTable,
+            {(uint64_t)candidate.docID, candidate.score});
+    }
+    sharedState.factorizedTablePool.returnLocalTable(localTable);
+}
+
+// The top-k evaluator runs on a single thread and looks up every candidate document on its own. It
+// only pays off if the postings of the leading term, i.e., the term with the fewest documents, are
+// sparse. Otherwise, all documents are scored by the parallel edge and vertex computes.
+static bool useTopKEvaluator(const QueryFTSBindData& bindData,
+    const std::unordered_map<offset_t, uint64_t>& dfs) {
+    if (bindData.getConfig().topK == INVALID_TOP_K) {
+        return false;
+    }
+    if (dfs.empty()) {
+        return true;
+    }
+    uint64_t leadingDF = UINT64_MAX;
+    for (auto& [_, df] : dfs) {
+        leadingDF = std::min(leadingDF, df);
+    }
+    return leadingDF < getSparseFrontierSize(bindData.numDocs);
+}
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto clientContext = input.context->clientContext;
     auto transaction = clientContext->getTransaction();
@@ -315,6 +537,13 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto& termsEntry = graphEntry->nodeInfos[0].entry->constCast<catalog::NodeTableCatalogEntry>();
     auto terms = qFTSBindData->getTerms(*input.context->clientContext);
     auto dfs = getDFs(*input.context->clientContext, termsEntry, terms);
+    if (useTopKEvaluator(*qFTSBindData, dfs)) {
+        QFTSTopKEvaluator evaluator{graph, *qFTSBindData, termsEntry.getTableID(), dfs};
+        evaluator.evaluate(getNumUniqueTerms(terms), clientContext->getMemoryManager(),
+            *sharedState);
+        sharedState->finalizeResult();
+        return 0;
+    }
     // Do edge compute to extend terms -> docs and save the term frequency and document frequency
     // for each term-doc pair. The reason why we store the term frequency and document frequency
     // is that: we need the `len` property from the docs table which is only available during the
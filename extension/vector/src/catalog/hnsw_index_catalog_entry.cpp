@@ -39,9 +39,14 @@ std::string HNSWIndexAuxInfo::toCypher(const IndexCatalogEntry& indexEntry,
     auto propertyName = tableEntry->getProperty(indexEntry.getPropertyIDs()[0]).getName();
     auto metricName = HNSWIndexConfig::metricToString(config.metric);
     cypher += common::stringFormat("CALL CREATE_VECTOR_INDEX('{}', '{}', '{}', mu := {}, ml := {}, "
-                                   "pu := {}, metric := '{}', alpha := {}, efc := {});",
+                                   "pu := {}, metric := '{}', alpha := {}, efc := {}",
         tableName, indexEntry.getIndexName(), propertyName, config.mu, config.ml, config.pu,
         metricName, config.alpha, config.efc);
+    if (config.quantization != QuantizationType::NONE) {
+        cypher += common::stringFormat(", quantization := '{}'",
+            HNSWIndexConfig::quantizationToString(config.quantization));
+    }
+    cypher += ");";
     return cypher;
 }
 
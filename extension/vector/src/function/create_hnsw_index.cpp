@@ -340,6 +340,8 @@ static std::string rewriteCreateHNSWQuery(main::ClientContext& context,
     params += stringFormat("metric := '{}', ", HNSWIndexConfig::metricToString(config.metric));
     params += stringFormat("alpha := {}, ", config.alpha);
     params += stringFormat("pu := {}, ", config.pu);
+    params += stringFormat("quantization := '{}', ",
+        HNSWIndexConfig::quantizationToString(config.quantization));
     params +=
         stringFormat("cache_embeddings := {}", config.cacheEmbeddingsColumn ? "true" : "false");
     auto columnName = hnswBindData->tableEntry->getProperty(hnswBindData->propertyID).getName();
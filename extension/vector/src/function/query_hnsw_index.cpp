@@ -232,6 +232,7 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output)
         auto indexOpt = nodeTable->getIndex(bindData->indexEntry->getIndexName());
         KU_ASSERT(indexOpt.has_value());
         auto& index = indexOpt.value()->cast<OnDiskHNSWIndex>();
+        index.initQuantizedSearchState(input.context->clientContext, localState->searchState);
         const auto dimension = ArrayType::getNumElements(
             getIndexColumnType(*bindData->nodeTableEntry, *bindData->indexEntry));
         auto indexType = index.getElementType();
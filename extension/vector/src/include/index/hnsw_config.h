@@ -10,6 +10,8 @@ namespace vector_extension {
 
 enum class MetricType : uint8_t { Cosine = 0, L2 = 1, L2_SQUARE = 2, DotProduct = 3 };
 
+enum class QuantizationType : uint8_t { NONE = 0, SQ8 = 1 };
+
 // We use this ratio to calculate the max degree of the upper/lower graph based on the user provided
 // max degree value for the upper/lower graph, respectively.
 static constexpr double DEFAULT_DEGREE_THRESHOLD_RATIO = 1.25;
@@ -79,6 +81,16 @@ struct CacheEmbeddings {
     static constexpr bool DEFAULT_VALUE = true;
 };
 
+// Encoding of the embeddings used to score candidates during search. The final candidates are
+// always re-ranked against the full precision embeddings.
+struct Quantization {
+    static constexpr const char* NAME = "quantization";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+    static constexpr QuantizationType DEFAULT_VALUE = QuantizationType::NONE;
+
+    static void validate(const std::string& quantization);
+};
+
 struct BlindSearchUpSelThreshold {
     static constexpr const char* NAME = "blind_search_up_sel";
     static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
@@ -103,6 +115,7 @@ struct HNSWIndexConfig {
     double alpha = Alpha::DEFAULT_VALUE;
     int64_t efc = Efc::DEFAULT_VALUE;
     bool cacheEmbeddingsColumn = CacheEmbeddings::DEFAULT_VALUE;
+    QuantizationType quantization = Quantization::DEFAULT_VALUE;
 
     HNSWIndexConfig() = default;
 
@@ -115,13 +128,16 @@ struct HNSWIndexConfig {
     static HNSWIndexConfig deserialize(common::Deserializer& deSer);
 
     static std::string metricToString(MetricType metric);
+    static std::string quantizationToString(QuantizationType quantization);
 
 private:
     HNSWIndexConfig(const HNSWIndexConfig& other)
         : mu{other.mu}, ml{other.ml}, pu{other.pu}, metric{other.metric}, alpha{other.alpha},
-          efc{other.efc}, cacheEmbeddingsColumn(other.cacheEmbeddingsColumn) {}
+          efc{other.efc}, cacheEmbeddingsColumn(other.cacheEmbeddingsColumn),
+          quantization{other.quantization} {}
 
     static MetricType getMetricType(const std::string& metricName);
+    static QuantizationType getQuantizationType(const std::string& quantizationName);
 };
 
 struct QueryHNSWConfig {
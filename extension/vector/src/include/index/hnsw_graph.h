@@ -2,6 +2,7 @@
 
 #include <bitset>
 #include <cmath>
+#include <stack>
 
 #include "common/data_chunk/data_chunk.h"
 #include "processor/operator/base_partitioner_shared_state.h"
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <queue>
 
 #include "common/random_engine.h"
@@ -7,6 +8,7 @@
 #include "index/hnsw_config.h"
 #include "index/hnsw_graph.h"
 #include "index/hnsw_index_utils.h"
+#include "index/hnsw_quantized_embeddings.h"
 #include "storage/index/index.h"
 
 namespace kuzu {
@@ -63,17 +65,21 @@ struct HNSWStorageInfo final : storage::IndexStorageInfo {
     common::offset_t upperEntryPoint;
     common::offset_t lowerEntryPoint;
     common::offset_t numCheckpointedNodes;
+    // Number of nodes covered by the persisted SQ8 codes, and the pages holding the codes of each
+    // node group.
+    common::offset_t numQuantizedNodes;
+    std::vector<storage::PageRange> quantizedPageRanges;
 
     HNSWStorageInfo()
         : upperRelTableID{common::INVALID_TABLE_ID}, lowerRelTableID{common::INVALID_TABLE_ID},
           upperEntryPoint{common::INVALID_OFFSET}, lowerEntryPoint{common::INVALID_OFFSET},
-          numCheckpointedNodes{0} {}
+          numCheckpointedNodes{0}, numQuantizedNodes{0} {}
     HNSWStorageInfo(common::table_id_t upperRelTableID, common::table_id_t lowerRelTableID,
         common::offset_t upperEntryPoint, common::offset_t lowerEntryPoint,
         common::offset_t numCheckpointedNodes)
         : upperRelTableID{upperRelTableID}, lowerRelTableID{lowerRelTableID},
           upperEntryPoint{upperEntryPoint}, lowerEntryPoint{lowerEntryPoint},
-          numCheckpointedNodes{numCheckpointedNodes} {}
+          numCheckpointedNodes{numCheckpointedNodes}, numQuantizedNodes{0} {}
 
     std::shared_ptr<common::BufferWriter> serialize() const override;
 
@@ -255,6 +261,10 @@ struct HNSWSearchState {
     VisitedState visited;
     std::unique_ptr<HNSWIndexEmbeddings> embeddings;
     OnDiskEmbeddingScanState embeddingScanState;
+    // Quantized embeddings used to score candidates in the graph search. The final candidates are
+    // re-ranked with the full precision embeddings.
+    std::unique_ptr<HNSWIndexEmbeddings> quantizedEmbeddings;
+    std::unique_ptr<GetEmbeddingsScanState> quantizedScanState;
     uint64_t k;
     QueryHNSWConfig config;
     uint64_t ef;
@@ -278,6 +288,18 @@ struct HNSWSearchState {
         return !hasMask() || semiMask->isMasked(offset);
     }
     bool hasMask() const { return semiMask != nullptr; }
+
+    bool isQuantized() const { return quantizedEmbeddings != nullptr; }
+    // Falls back to the full precision embedding if the embedding is not quantized.
+    EmbeddingHandle getSearchEmbedding(common::offset_t offset) {
+        if (isQuantized()) {
+            auto embedding = quantizedEmbeddings->getEmbedding(offset, *quantizedScanState);
+            if (!embedding.isNull()) {
+                return embedding;
+            }
+        }
+        return embeddings->getEmbedding(offset, embeddingScanState);
+    }
 };
 
 class OnDiskHNSWIndex final : public HNSWIndex {
@@ -306,6 +328,10 @@ public:
 
     std::vector<NodeWithDistance> search(transaction::Transaction* transaction,
         const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const;
+    // Sets up the search state to score candidates with the quantized embeddings if the index is
+    // quantized. Codes of the nodes inserted into the graph since the last checkpoint are built
+    // lazily in memory.
+    void initQuantizedSearchState(main::ClientContext* context, HNSWSearchState& searchState);
 
     static std::unique_ptr<Index> load(main::ClientContext* context,
         storage::StorageManager* storageManager, storage::IndexInfo indexInfo,
@@ -324,6 +350,7 @@ public:
     }
 
     void finalize(main::ClientContext*) override;
+    void prepareCheckpoint(main::ClientContext* context) override;
     void checkpoint(main::ClientContext* context, storage::PageAllocator& pageAllocator) override;
 
 private:
@@ -337,6 +364,8 @@ private:
     void searchFromUnCheckpointed(transaction::Transaction* transaction,
         const EmbeddingHandle& queryVector, HNSWSearchState& searchState,
         std::vector<NodeWithDistance>& result) const;
+    void reRankCandidates(const EmbeddingHandle& queryVector, HNSWSearchState& searchState,
+        std::vector<NodeWithDistance>& candidates) const;
 
     void initLayerSearchState(transaction::Transaction* transaction, HNSWSearchState& searchState,
         bool isUpperLayer) const;
@@ -395,6 +424,10 @@ private:
     storage::NodeTable& nodeTable;
     storage::RelTable* upperRelTable;
     storage::RelTable* lowerRelTable;
+    std::mutex quantizedStoreMtx;
+    std::shared_ptr<const SQ8EmbeddingStore> quantizedStore;
+    // Codes encoded from the committed embeddings before the table is checkpointed.
+    std::shared_ptr<const SQ8EmbeddingStore> checkpointQuantizedStore;
 };
 
 } // namespace vector_extension
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <stack>
+
+#include "index/hnsw_graph.h"
+#include "index/hnsw_index_utils.h"
+#include "storage/page_range.h"
+#include "storage/storage_utils.h"
+
+namespace kuzu {
+namespace storage {
+class FileHandle;
+class NodeTable;
+class PageAllocator;
+} // namespace storage
+namespace vector_extension {
+
+// SQ8 codes of the embeddings in a node group. Each dimension is encoded as an 8-bit code relative
+// to the min value and step of the dimension within the node group. Once persisted, the codes are
+// read from the pages of the segment instead of being kept in memory.
+struct SQ8Segment {
+    std::vector<float> mins;
+    std::vector<float> steps;
+    std::vector<uint8_t> codes;
+    std::vector<bool> encoded;
+    // Holds the codebook followed by the codes of all rows if the segment is persisted.
+    storage::PageRange pageRange;
+
+    bool isPersisted() const { return pageRange.numPages > 0; }
+
+    static uint64_t getCodebookSize(common::length_t dimension) {
+        return 2 * dimension * sizeof(float);
+    }
+};
+
+/**
+ * @brief SQ8 codes of the committed embeddings in [0, numNodes). A store is immutable once built,
+ * so searches can keep using it while a newer version is being built. Segments written at
+ * checkpoint are read from the data file, while segments encoded since then are kept in memory.
+ * Embeddings that are not encoded (e.g. nulls, or rows not committed when the codes were built)
+ * are read from the column instead.
+ */
+class SQ8EmbeddingStore {
+public:
+    SQ8EmbeddingStore(common::LogicalType elementType, common::length_t dimension,
+        storage::FileHandle* dataFH)
+        : elementType{std::move(elementType)}, dimension{dimension}, dataFH{dataFH}, numNodes{0} {}
+
+    const common::LogicalType& getElementType() const { return elementType; }
+    common::length_t getDimension() const { return dimension; }
+    common::offset_t getNumNodes() const { return numNodes; }
+
+    bool isEncoded(common::offset_t offset) const {
+        if (offset >= numNodes) {
+            return false;
+        }
+        auto [nodeGroupIdx, offsetInGroup] =
+            storage::StorageUtils::getNodeGroupIdxAndOffsetInChunk(offset);
+        const auto& segment = *segments[nodeGroupIdx];
+        // Persisted segments are encoded when no transaction is active. Their null embeddings are
+        // never part of the graph, so their codes are not read.
+        return segment.isPersisted() || segment.encoded[offsetInGroup];
+    }
+
+    template<VectorElementType T>
+    void decode(common::offset_t offset, T* result) const {
+        auto [nodeGroupIdx, offsetInGroup] =
+            storage::StorageUtils::getNodeGroupIdxAndOffsetInChunk(offset);
+        const auto& segment = *segments[nodeGroupIdx];
+        const auto decodeCodes = [&](const uint8_t* code, common::idx_t startDim,
+                                     common::length_t numDims) {
+            for (auto i = startDim; i < startDim + numDims; i++) {
+                result[i] = static_cast<T>(
+                    segment.mins[i] + segment.steps[i] * static_cast<float>(code[i - startDim]));
+            }
+        };
+        if (segment.isPersisted()) {
+            readPersisted(segment.pageRange,
+                SQ8Segment::getCodebookSize(dimension) + offsetInGroup * dimension, dimension,
+                decodeCodes);
+        } else {
+            decodeCodes(segment.codes.data() + offsetInGroup * dimension, 0, dimension);
+        }
+    }
+
+    // Returns a store that covers the embeddings in [0, targetNumNodes). The segments from the
+    // one holding startOffset are re-encoded, so that their codebooks cover the new rows. All
+    // other segments are shared with this store.
+    std::unique_ptr<SQ8EmbeddingStore> encode(storage::MemoryManager* mm,
+        storage::NodeTable& nodeTable, common::column_id_t columnID, common::offset_t startOffset,
+        common::offset_t targetNumNodes) const;
+    // Returns a store with the in-memory segments written to newly allocated pages.
+    std::unique_ptr<SQ8EmbeddingStore> persist(storage::PageAllocator& pageAllocator) const;
+    // Loads the codebooks of the persisted segments covering [0, numNodes).
+    static std::unique_ptr<SQ8EmbeddingStore> load(common::LogicalType elementType,
+        common::length_t dimension, storage::FileHandle* dataFH, common::offset_t numNodes,
+        const std::vector<storage::PageRange>& pageRanges);
+
+    std::vector<storage::PageRange> getPageRanges() const;
+
+private:
+    SQ8EmbeddingStore(const SQ8EmbeddingStore& other)
+        : elementType{other.elementType.copy()}, dimension{other.dimension}, dataFH{other.dataFH},
+          numNodes{other.numNodes}, segments{other.segments} {}
+
+    // Calls func on the bytes in [startPos, startPos + size) of the page range, one page at a time.
+    void readPersisted(const storage::PageRange& pageRange, uint64_t startPos, uint64_t size,
+        const std::function<void(const uint8_t*, common::idx_t, common::length_t)>& func) const;
+
+    template<VectorElementType T>
+    std::shared_ptr<const SQ8Segment> encodeNodeGroup(storage::MemoryManager* mm,
+        storage::NodeTable& nodeTable, common::column_id_t columnID,
+        common::node_group_idx_t nodeGroupIdx, common::offset_t endOffset) const;
+
+private:
+    common::LogicalType elementType;
+    common::length_t dimension;
+    storage::FileHandle* dataFH;
+    common::offset_t numNodes;
+    std::vector<std::shared_ptr<const SQ8Segment>> segments;
+};
+
+// Decodes SQ8 codes into reusable slots of full precision values.
+class SQ8EmbeddingScanState final : public GetEmbeddingsScanState {
+public:
+    explicit SQ8EmbeddingScanState(std::shared_ptr<const SQ8EmbeddingStore> store)
+        : store{std::move(store)}, numSlots{0} {}
+
+    void* getEmbeddingPtr(const EmbeddingHandle& handle) override;
+    void addEmbedding(const EmbeddingHandle&) override {}
+    void reclaimEmbedding(const EmbeddingHandle& handle) override {
+        freeSlots.push(handle.offsetInData);
+    }
+
+    // Decodes the embedding at the given offset and returns the slot holding it.
+    common::idx_t decode(common::offset_t offset);
+
+private:
+    std::shared_ptr<const SQ8EmbeddingStore> store;
+    std::vector<uint8_t> slots;
+    common::idx_t numSlots;
+    std::stack<common::idx_t> freeSlots;
+};
+
+class SQ8Embeddings final : public HNSWIndexEmbeddings {
+public:
+    SQ8Embeddings(const transaction::Transaction* transaction, common::ArrayTypeInfo typeInfo,
+        storage::NodeTable& nodeTable, std::shared_ptr<const SQ8EmbeddingStore> store)
+        : HNSWIndexEmbeddings{std::move(typeInfo)}, transaction{transaction},
+          nodeTable{nodeTable}, store{std::move(store)} {}
+
+    EmbeddingHandle getEmbedding(common::offset_t offset,
+        GetEmbeddingsScanState& scanState) const override;
+    std::vector<EmbeddingHandle> getEmbeddings(std::span<const common::offset_t> offsets,
+        GetEmbeddingsScanState& scanState) const override;
+    std::unique_ptr<GetEmbeddingsScanState> constructScanState() const override;
+
+private:
+    const transaction::Transaction* transaction;
+    storage::NodeTable& nodeTable;
+    std::shared_ptr<const SQ8EmbeddingStore> store;
+};
+
+} // namespace vector_extension
+} // namespace kuzu
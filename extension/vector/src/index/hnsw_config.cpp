@@ -48,6 +48,13 @@ void Metric::validate(const std::string& metric) {
     }
 }
 
+void Quantization::validate(const std::string& quantization) {
+    const auto lowerCaseQuantization = common::StringUtils::getLower(quantization);
+    if (lowerCaseQuantization != "none" && lowerCaseQuantization != "sq8") {
+        throw common::BinderException{"Quantization must be one of NONE or SQ8."};
+    }
+}
+
 void Efc::validate(int64_t value) {
     if (value < 1) {
         throw common::BinderException{"Efc must be a positive integer."};
@@ -111,6 +118,11 @@ HNSWIndexConfig::HNSWIndexConfig(const function::optional_params_t& optionalPara
         } else if (CacheEmbeddings::NAME == lowerCaseName) {
             value.validateType(CacheEmbeddings::TYPE);
             cacheEmbeddingsColumn = value.getValue<bool>();
+        } else if (Quantization::NAME == lowerCaseName) {
+            value.validateType(Quantization::TYPE);
+            auto quantizationName = value.getValue<std::string>();
+            Quantization::validate(quantizationName);
+            quantization = getQuantizationType(quantizationName);
         } else {
             throw common::BinderException{
                 common::stringFormat("Unrecognized optional parameter {} in {}.", name,
@@ -140,6 +152,21 @@ std::string HNSWIndexConfig::metricToString(MetricType metric) {
     }
 }
 
+std::string HNSWIndexConfig::quantizationToString(QuantizationType quantization) {
+    switch (quantization) {
+    case QuantizationType::NONE: {
+        return "none";
+    }
+    case QuantizationType::SQ8: {
+        return "sq8";
+    }
+    default: {
+        throw common::RuntimeException(common::stringFormat("Unknown quantization type {}.",
+            static_cast<int64_t>(quantization)));
+    }
+    }
+}
+
 void HNSWIndexConfig::serialize(common::Serializer& ser) const {
     ser.writeDebuggingInfo("degreeInUpperLayer");
     ser.serializeValue(mu);
@@ -151,6 +178,8 @@ void HNSWIndexConfig::serialize(common::Serializer& ser) const {
     ser.serializeValue(alpha);
     ser.writeDebuggingInfo("efc");
     ser.serializeValue(efc);
+    ser.writeDebuggingInfo("quantization");
+    ser.serializeValue<uint8_t>(static_cast<uint8_t>(quantization));
 }
 
 HNSWIndexConfig HNSWIndexConfig::deserialize(common::Deserializer& deSer) {
@@ -168,6 +197,13 @@ HNSWIndexConfig HNSWIndexConfig::deserialize(common::Deserializer& deSer) {
     deSer.deserializeValue(config.alpha);
     deSer.validateDebuggingInfo(debuggingInfo, "efc");
     deSer.deserializeValue(config.efc);
+    // Indexes created before quantization was supported end here and are not quantized.
+    if (!deSer.finished()) {
+        deSer.validateDebuggingInfo(debuggingInfo, "quantization");
+        uint8_t quantization = 0;
+        deSer.deserializeValue(quantization);
+        config.quantization = static_cast<QuantizationType>(quantization);
+    }
     return config;
 }
 
@@ -188,6 +224,17 @@ MetricType HNSWIndexConfig::getMetricType(const std::string& metricName) {
     KU_UNREACHABLE;
 }
 
+QuantizationType HNSWIndexConfig::getQuantizationType(const std::string& quantizationName) {
+    const auto lowerQuantizationName = common::StringUtils::getLower(quantizationName);
+    if (lowerQuantizationName == "none") {
+        return QuantizationType::NONE;
+    }
+    if (lowerQuantizationName == "sq8") {
+        return QuantizationType::SQ8;
+    }
+    KU_UNREACHABLE;
+}
+
 QueryHNSWConfig::QueryHNSWConfig(const function::optional_params_t& optionalParams) {
     for (auto& [name, value] : optionalParams) {
         auto lowerCaseName = common::StringUtils::getLower(name);
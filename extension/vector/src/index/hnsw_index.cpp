@@ -5,6 +5,7 @@
 #include "function/hnsw_index_functions.h"
 #include "index/hnsw_rel_batch_insert.h"
 #include "main/client_context.h"
+#include "storage/page_allocator.h"
 #include "storage/storage_manager.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
@@ -385,6 +386,12 @@ std::shared_ptr<common::BufferWriter> HNSWStorageInfo::serialize() const {
     serializer.write<common::offset_t>(upperEntryPoint);
     serializer.write<common::offset_t>(lowerEntryPoint);
     serializer.write<common::offset_t>(numCheckpointedNodes);
+    serializer.write<common::offset_t>(numQuantizedNodes);
+    serializer.write<uint64_t>(quantizedPageRanges.size());
+    for (const auto& pageRange : quantizedPageRanges) {
+        serializer.write<common::page_idx_t>(pageRange.startPageIdx);
+        serializer.write<common::page_idx_t>(pageRange.numPages);
+    }
     return bufferWriter;
 }
 
@@ -401,8 +408,20 @@ std::unique_ptr<IndexStorageInfo> HNSWStorageInfo::deserialize(
     deSer.deserializeValue<common::offset_t>(upperEntryPoint);
     deSer.deserializeValue<common::offset_t>(lowerEntryPoint);
     deSer.deserializeValue<common::offset_t>(checkpointedNodeOffset);
-    return std::make_unique<HNSWStorageInfo>(upperRelTableID, lowerRelTableID, upperEntryPoint,
-        lowerEntryPoint, checkpointedNodeOffset);
+    auto storageInfo = std::make_unique<HNSWStorageInfo>(upperRelTableID, lowerRelTableID,
+        upperEntryPoint, lowerEntryPoint, checkpointedNodeOffset);
+    // Indexes created before the SQ8 codes were persisted end here.
+    if (!deSer.finished()) {
+        deSer.deserializeValue<common::offset_t>(storageInfo->numQuantizedNodes);
+        uint64_t numPageRanges = 0;
+        deSer.deserializeValue<uint64_t>(numPageRanges);
+        storageInfo->quantizedPageRanges.resize(numPageRanges);
+        for (auto& pageRange : storageInfo->quantizedPageRanges) {
+            deSer.deserializeValue<common::page_idx_t>(pageRange.startPageIdx);
+            deSer.deserializeValue<common::page_idx_t>(pageRange.numPages);
+        }
+    }
+    return storageInfo;
 }
 
 HNSWSearchState::HNSWSearchState(main::ClientContext* context,
@@ -414,7 +433,8 @@ HNSWSearchState::HNSWSearchState(main::ClientContext* context,
           context->getMemoryManager(), getArrayTypeInfo(nodeTable, columnID), nodeTable, columnID)},
       embeddingScanState{context->getTransaction(), context->getMemoryManager(), nodeTable,
           columnID, embeddings->getDimension()},
-      k{k}, config{config}, semiMask{nullptr}, upperRelTableEntry{upperRelTableEntry},
+      quantizedEmbeddings{nullptr}, quantizedScanState{nullptr}, k{k}, config{config},
+      semiMask{nullptr}, upperRelTableEntry{upperRelTableEntry},
       lowerRelTableEntry{lowerRelTableEntry}, searchType{SearchType::UNFILTERED},
       nbrScanState{nullptr}, secondHopNbrScanState{nullptr} {
     ef = std::max(k, static_cast<uint64_t>(config.efs));
@@ -465,6 +485,11 @@ OnDiskHNSWIndex::OnDiskHNSWIndex(const main::ClientContext* context, IndexInfo i
     const auto& hnswStorageInfo = this->storageInfo->cast<HNSWStorageInfo>();
     lowerRelTable = storageManager->getTable(hnswStorageInfo.lowerRelTableID)->ptrCast<RelTable>();
     upperRelTable = storageManager->getTable(hnswStorageInfo.upperRelTableID)->ptrCast<RelTable>();
+    if (this->config.quantization != QuantizationType::NONE) {
+        quantizedStore = SQ8EmbeddingStore::load(typeInfo.getChildType().copy(),
+            typeInfo.getNumElements(), storageManager->getDataFH(),
+            hnswStorageInfo.numQuantizedNodes, hnswStorageInfo.quantizedPageRanges);
+    }
 }
 
 std::unique_ptr<Index> OnDiskHNSWIndex::load(main::ClientContext* context, StorageManager*,
@@ -483,11 +508,63 @@ std::unique_ptr<Index> OnDiskHNSWIndex::load(main::ClientContext* context, Stora
 std::vector<NodeWithDistance> OnDiskHNSWIndex::search(Transaction* transaction,
     const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
     auto result = searchFromCheckpointed(transaction, queryVector, searchState);
+    if (searchState.isQuantized()) {
+        reRankCandidates(queryVector, searchState, result);
+    }
     searchFromUnCheckpointed(transaction, queryVector, searchState, result);
     result.resize(searchState.k);
     return result;
 }
 
+void OnDiskHNSWIndex::initQuantizedSearchState(main::ClientContext* context,
+    HNSWSearchState& searchState) {
+    if (config.quantization == QuantizationType::NONE) {
+        return;
+    }
+    KU_ASSERT(config.quantization == QuantizationType::SQ8);
+    const auto numCheckpointedNodes = storageInfo->cast<HNSWStorageInfo>().numCheckpointedNodes;
+    std::shared_ptr<const SQ8EmbeddingStore> store;
+    {
+        std::unique_lock lck{quantizedStoreMtx};
+        store = quantizedStore;
+    }
+    if (store->getNumNodes() < numCheckpointedNodes) {
+        // The codes are encoded outside the lock, so that concurrent searches are not blocked.
+        // Searches holding the previous store are not affected by the replacement.
+        std::shared_ptr<const SQ8EmbeddingStore> newStore = store->encode(mm, nodeTable,
+            indexInfo.columnIDs[0], store->getNumNodes(), numCheckpointedNodes);
+        std::unique_lock lck{quantizedStoreMtx};
+        if (quantizedStore->getNumNodes() < newStore->getNumNodes()) {
+            quantizedStore.swap(newStore);
+        }
+        store = quantizedStore;
+    }
+    searchState.quantizedEmbeddings = std::make_unique<SQ8Embeddings>(context->getTransaction(),
+        common::ArrayTypeInfo{typeInfo.getChildType().copy(), typeInfo.getNumElements()},
+        nodeTable, std::move(store));
+    searchState.quantizedScanState = searchState.quantizedEmbeddings->constructScanState();
+}
+
+void OnDiskHNSWIndex::reRankCandidates(const EmbeddingHandle& queryVector,
+    HNSWSearchState& searchState, std::vector<NodeWithDistance>& candidates) const {
+    std::erase_if(candidates, [&](NodeWithDistance& candidate) {
+        const auto vector = searchState.embeddings->getEmbedding(candidate.nodeOffset,
+            searchState.embeddingScanState);
+        if (vector.isNull()) {
+            return true;
+        }
+        candidate.distance = metricFunc(queryVector.getPtr(), vector.getPtr(),
+            searchState.embeddings->getDimension());
+        return false;
+    });
+    std::ranges::sort(candidates, [](const NodeWithDistance& l, const NodeWithDistance& r) {
+        return l.distance < r.distance;
+    });
+    if (candidates.size() > searchState.k) {
+        candidates.resize(searchState.k);
+    }
+}
+
 std::vector<NodeWithDistance> OnDiskHNSWIndex::searchFromCheckpointed(Transaction* transaction,
     const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
     auto entryPoint = searchNNInUpperLayer(queryVector, searchState);
@@ -632,12 +709,47 @@ void OnDiskHNSWIndex::finalize(main::ClientContext* context) {
     hnswStorageInfo.numCheckpointedNodes = numTotalRows;
 }
 
+void OnDiskHNSWIndex::prepareCheckpoint(main::ClientContext*) {
+    const auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    if (config.quantization == QuantizationType::NONE ||
+        hnswStorageInfo.numQuantizedNodes == hnswStorageInfo.numCheckpointedNodes) {
+        return;
+    }
+    std::shared_ptr<const SQ8EmbeddingStore> store;
+    {
+        std::unique_lock lck{quantizedStoreMtx};
+        store = quantizedStore;
+    }
+    // Codes encoded lazily can miss rows that were not committed yet, so all codes that are not
+    // persisted are encoded again from the committed embeddings.
+    checkpointQuantizedStore = store->encode(mm, nodeTable, indexInfo.columnIDs[0],
+        hnswStorageInfo.numQuantizedNodes, hnswStorageInfo.numCheckpointedNodes);
+}
+
 void OnDiskHNSWIndex::checkpoint(main::ClientContext* context,
     storage::PageAllocator& pageAllocator) {
     auto [nodeTableEntry, upperRelTableEntry, lowerRelTableEntry] = getIndexTableCatalogEntries(
         context->getCatalog(), &DUMMY_CHECKPOINT_TRANSACTION, indexInfo);
     upperRelTable->checkpoint(context, upperRelTableEntry, pageAllocator);
     lowerRelTable->checkpoint(context, lowerRelTableEntry, pageAllocator);
+    if (checkpointQuantizedStore != nullptr) {
+        auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+        std::shared_ptr<const SQ8EmbeddingStore> store =
+            checkpointQuantizedStore->persist(pageAllocator);
+        auto pageRanges = store->getPageRanges();
+        // The last node group persisted before is encoded again if rows were added to it.
+        for (auto i = 0u; i < hnswStorageInfo.quantizedPageRanges.size(); i++) {
+            const auto& pageRange = hnswStorageInfo.quantizedPageRanges[i];
+            if (pageRanges[i].startPageIdx != pageRange.startPageIdx) {
+                pageAllocator.freePageRange(pageRange);
+            }
+        }
+        hnswStorageInfo.numQuantizedNodes = store->getNumNodes();
+        hnswStorageInfo.quantizedPageRanges = std::move(pageRanges);
+        checkpointQuantizedStore.reset();
+        std::unique_lock lck{quantizedStoreMtx};
+        quantizedStore.swap(store);
+    }
 }
 
 void OnDiskHNSWIndex::insertInternal(Transaction* transaction, common::offset_t offset,
@@ -663,8 +775,7 @@ common::offset_t OnDiskHNSWIndex::searchNNInUpperLayer(const EmbeddingHandle& qu
     }
     double lastMinDist = std::numeric_limits<float>::max();
     const auto& embeddings = searchState.embeddings;
-    const auto currNodeVector =
-        embeddings->getEmbedding(currentNodeOffset, searchState.embeddingScanState);
+    const auto currNodeVector = searchState.getSearchEmbedding(currentNodeOffset);
     double minDist = 0.0;
     if (!currNodeVector.isNull()) {
         minDist =
@@ -679,8 +790,7 @@ common::offset_t OnDiskHNSWIndex::searchNNInUpperLayer(const EmbeddingHandle& qu
         for (const auto neighborChunk : neighborItr) {
             neighborChunk.forEach([&](auto neighbors, auto, auto i) {
                 auto neighbor = neighbors[i];
-                const auto nbrVector =
-                    embeddings->getEmbedding(neighbor.offset, searchState.embeddingScanState);
+                const auto nbrVector = searchState.getSearchEmbedding(neighbor.offset);
                 if (!nbrVector.isNull()) {
                     const auto dist = metricFunc(queryVector.getPtr(), nbrVector.getPtr(),
                         embeddings->getDimension());
@@ -721,8 +831,7 @@ std::vector<NodeWithDistance> OnDiskHNSWIndex::searchKNNInLayer(Transaction* tra
     max_node_priority_queue_t results;
     initLayerSearchState(transaction, searchState, isUpperLayer);
 
-    const auto entryVector =
-        searchState.embeddings->getEmbedding(entryNode, searchState.embeddingScanState);
+    const auto entryVector = searchState.getSearchEmbedding(entryNode);
     if (!entryVector.isNull()) {
         auto dist = metricFunc(queryVector.getPtr(), entryVector.getPtr(),
             searchState.embeddings->getDimension());
@@ -764,7 +873,8 @@ std::vector<NodeWithDistance> OnDiskHNSWIndex::searchKNNInLayer(Transaction* tra
         }
         }
     }
-    return popTopK(results, searchState.k);
+    // With quantized embeddings, all ef candidates are kept to be re-ranked at full precision.
+    return popTopK(results, searchState.isQuantized() ? searchState.ef : searchState.k);
 }
 
 SearchType OnDiskHNSWIndex::getFilteredSearchType(Transaction* transaction,
@@ -796,8 +906,7 @@ void OnDiskHNSWIndex::initSearchCandidates(const EmbeddingHandle& queryVector,
                 continue;
             }
             searchState.visited.add(candidate);
-            const auto candidateVector =
-                searchState.embeddings->getEmbedding(candidate, searchState.embeddingScanState);
+            const auto candidateVector = searchState.getSearchEmbedding(candidate);
             if (candidateVector.isNull()) {
                 continue;
             }
@@ -820,8 +929,7 @@ void OnDiskHNSWIndex::oneHopSearch(const EmbeddingHandle& queryVector,
         neighborChunk.forEach([&](auto neighbors, auto, auto i) {
             const auto nbr = neighbors[i];
             if (!searchState.visited.contains(nbr.offset) && searchState.isMasked(nbr.offset)) {
-                const auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                    searchState.embeddingScanState);
+                const auto nbrVector = searchState.getSearchEmbedding(nbr.offset);
                 processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, searchState.ef,
                     searchState.visited, metricFunc, searchState.embeddings->getDimension(),
                     candidates, results);
@@ -850,8 +958,7 @@ min_node_priority_queue_t OnDiskHNSWIndex::collectFirstHopNbrsDirected(
             const auto neighbor = neighbors[i];
             auto nbrOffset = neighbor.offset;
             if (!searchState.visited.contains(nbrOffset)) {
-                const auto nbrVector =
-                    searchState.embeddings->getEmbedding(nbrOffset, searchState.embeddingScanState);
+                const auto nbrVector = searchState.getSearchEmbedding(nbrOffset);
                 if (!nbrVector.isNull()) {
                     auto dist = metricFunc(queryVector.getPtr(), nbrVector.getPtr(),
                         searchState.embeddings->getDimension());
@@ -897,8 +1004,7 @@ common::offset_vec_t OnDiskHNSWIndex::collectFirstHopNbrsBlind(const EmbeddingHa
                 secondHopCandidates.push_back(nbr.offset);
                 if (searchState.isMasked(nbr.offset)) {
                     numVisitedNbrs++;
-                    auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                        searchState.embeddingScanState);
+                    auto nbrVector = searchState.getSearchEmbedding(nbr.offset);
                     processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, searchState.ef,
                         searchState.visited, metricFunc, searchState.embeddings->getDimension(),
                         candidates, results);
@@ -1094,8 +1200,7 @@ bool OnDiskHNSWIndex::searchOverSecondHopNbrs(const EmbeddingHandle& queryVector
         secondHopNbrChunk.forEachBreakWhenFalse([&](auto neighbors, auto i) -> bool {
             auto nbr = neighbors[i];
             if (!searchState.visited.contains(nbr.offset) && searchState.isMasked(nbr.offset)) {
-                auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                    searchState.embeddingScanState);
+                auto nbrVector = searchState.getSearchEmbedding(nbr.offset);
                 processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, ef,
                     searchState.visited, metricFunc, searchState.embeddings->getDimension(),
                     candidates, results);
@@ -0,0 +1,244 @@
+#include "index/hnsw_quantized_embeddings.h"
+
+#include "storage/file_handle.h"
+#include "storage/page_allocator.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace vector_extension {
+
+std::unique_ptr<SQ8EmbeddingStore> SQ8EmbeddingStore::encode(MemoryManager* mm,
+    NodeTable& nodeTable, common::column_id_t columnID, common::offset_t startOffset,
+    common::offset_t targetNumNodes) const {
+    KU_ASSERT(startOffset <= numNodes && targetNumNodes >= numNodes);
+    auto store = std::unique_ptr<SQ8EmbeddingStore>(new SQ8EmbeddingStore(*this));
+    for (auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(startOffset);
+         StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx) < targetNumNodes; nodeGroupIdx++) {
+        const auto endOffset =
+            std::min(targetNumNodes, StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx + 1));
+        std::shared_ptr<const SQ8Segment> segment;
+        common::TypeUtils::visit(
+            elementType,
+            [&]<VectorElementType T>(T) {
+                segment = encodeNodeGroup<T>(mm, nodeTable, columnID, nodeGroupIdx, endOffset);
+            },
+            [&](auto) { KU_UNREACHABLE; });
+        if (nodeGroupIdx < store->segments.size()) {
+            store->segments[nodeGroupIdx] = std::move(segment);
+        } else {
+            store->segments.push_back(std::move(segment));
+        }
+    }
+    store->numNodes = targetNumNodes;
+    return store;
+}
+
+std::unique_ptr<SQ8EmbeddingStore> SQ8EmbeddingStore::persist(PageAllocator& pageAllocator) const {
+    auto store = std::unique_ptr<SQ8EmbeddingStore>(new SQ8EmbeddingStore(*this));
+    const auto codebookSize = SQ8Segment::getCodebookSize(dimension);
+    for (auto& segment : store->segments) {
+        if (segment->isPersisted()) {
+            continue;
+        }
+        const auto size = codebookSize + segment->codes.size();
+        const auto numPages =
+            static_cast<common::page_idx_t>(common::ceilDiv(size, common::KUZU_PAGE_SIZE));
+        std::vector<uint8_t> buffer(numPages * common::KUZU_PAGE_SIZE, 0);
+        memcpy(buffer.data(), segment->mins.data(), dimension * sizeof(float));
+        memcpy(buffer.data() + dimension * sizeof(float), segment->steps.data(),
+            dimension * sizeof(float));
+        memcpy(buffer.data() + codebookSize, segment->codes.data(), segment->codes.size());
+        const auto pageRange = pageAllocator.allocatePageRange(numPages);
+        dataFH->writePagesToFile(buffer.data(), buffer.size(), pageRange.startPageIdx);
+        // Only the codebook is kept in memory once the codes are persisted.
+        auto persistedSegment = std::make_shared<SQ8Segment>();
+        persistedSegment->mins = segment->mins;
+        persistedSegment->steps = segment->steps;
+        persistedSegment->pageRange = pageRange;
+        segment = std::move(persistedSegment);
+    }
+    return store;
+}
+
+std::unique_ptr<SQ8EmbeddingStore> SQ8EmbeddingStore::load(common::LogicalType elementType,
+    common::length_t dimension, FileHandle* dataFH, common::offset_t numNodes,
+    const std::vector<PageRange>& pageRanges) {
+    auto store = std::make_unique<SQ8EmbeddingStore>(std::move(elementType), dimension, dataFH);
+    for (const auto& pageRange : pageRanges) {
+        std::vector<uint8_t> codebook(SQ8Segment::getCodebookSize(dimension));
+        store->readPersisted(pageRange, 0, codebook.size(),
+            [&](const uint8_t* data, common::idx_t pos, common::length_t size) {
+                memcpy(codebook.data() + pos, data, size);
+            });
+        auto segment = std::make_shared<SQ8Segment>();
+        segment->mins.resize(dimension);
+        segment->steps.resize(dimension);
+        memcpy(segment->mins.data(), codebook.data(), dimension * sizeof(float));
+        memcpy(segment->steps.data(), codebook.data() + dimension * sizeof(float),
+            dimension * sizeof(float));
+        segment->pageRange = pageRange;
+        store->segments.push_back(std::move(segment));
+    }
+    store->numNodes = numNodes;
+    return store;
+}
+
+std::vector<PageRange> SQ8EmbeddingStore::getPageRanges() const {
+    std::vector<PageRange> pageRanges;
+    pageRanges.reserve(segments.size());
+    for (const auto& segment : segments) {
+        pageRanges.push_back(segment->pageRange);
+    }
+    return pageRanges;
+}
+
+void SQ8EmbeddingStore::readPersisted(const PageRange& pageRange, uint64_t startPos, uint64_t size,
+    const std::function<void(const uint8_t*, common::idx_t, common::length_t)>& func) const {
+    for (uint64_t pos = 0; pos < size;) {
+        const auto posInRange = startPos + pos;
+        const auto pageIdx = static_cast<common::page_idx_t>(
+            pageRange.startPageIdx + posInRange / common::KUZU_PAGE_SIZE);
+        KU_ASSERT(pageIdx < pageRange.startPageIdx + pageRange.numPages);
+        const auto posInPage = posInRange % common::KUZU_PAGE_SIZE;
+        const auto numBytes = std::min(size - pos, common::KUZU_PAGE_SIZE - posInPage);
+        dataFH->optimisticReadPage(pageIdx,
+            [&](const uint8_t* frame) { func(frame + posInPage, pos, numBytes); });
+        pos += numBytes;
+    }
+}
+
+template<VectorElementType T>
+std::shared_ptr<const SQ8Segment> SQ8EmbeddingStore::encodeNodeGroup(MemoryManager* mm,
+    NodeTable& nodeTable, common::column_id_t columnID, common::node_group_idx_t nodeGroupIdx,
+    common::offset_t endOffset) const {
+    // The embeddings are scanned with the checkpoint transaction so that the codes only depend on
+    // committed data and not on the transaction triggering the encoding.
+    auto transaction = &transaction::DUMMY_CHECKPOINT_TRANSACTION;
+    std::vector<common::LogicalType> types;
+    types.emplace_back(common::LogicalType::INTERNAL_ID());
+    types.emplace_back(nodeTable.getColumn(columnID).getDataType().copy());
+    auto scanChunk = Table::constructDataChunk(mm, std::move(types));
+    NodeTableScanState scanState{&scanChunk.getValueVectorMutable(0),
+        std::vector{&scanChunk.getValueVectorMutable(1)}, scanChunk.state};
+    scanState.source = TableScanSource::COMMITTED;
+    scanState.setToTable(transaction, &nodeTable, {columnID});
+    const auto startOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+    const auto scanNodeGroup = [&](const std::function<void(common::offset_t, const T*)>& func) {
+        scanState.nodeGroupIdx = nodeGroupIdx;
+        nodeTable.initScanState(transaction, scanState);
+        while (nodeTable.scan(transaction, scanState)) {
+            const auto& embeddingVector = *scanState.outputVectors[0];
+            const auto values = reinterpret_cast<const T*>(
+                common::ListVector::getDataVector(&embeddingVector)->getData());
+            scanState.outState->getSelVector().forEach([&](auto pos) {
+                const auto offset = scanState.nodeIDVector->getValue<common::nodeID_t>(pos).offset;
+                if (offset < endOffset && !embeddingVector.isNull(pos)) {
+                    func(offset - startOffset,
+                        values + embeddingVector.getValue<common::list_entry_t>(pos).offset);
+                }
+            });
+        }
+    };
+
+    // Build the codebook from the value range of each dimension.
+    auto segment = std::make_shared<SQ8Segment>();
+    std::vector minValues(dimension, std::numeric_limits<float>::max());
+    std::vector maxValues(dimension, std::numeric_limits<float>::lowest());
+    scanNodeGroup([&](common::offset_t, const T* values) {
+        for (auto i = 0u; i < dimension; i++) {
+            minValues[i] = std::min(minValues[i], static_cast<float>(values[i]));
+            maxValues[i] = std::max(maxValues[i], static_cast<float>(values[i]));
+        }
+    });
+    segment->mins.resize(dimension, 0);
+    segment->steps.resize(dimension, 0);
+    for (auto i = 0u; i < dimension; i++) {
+        // Dimensions without any value (i.e. all embeddings are null) keep a zero codebook.
+        if (minValues[i] <= maxValues[i]) {
+            segment->mins[i] = minValues[i];
+            segment->steps[i] = (maxValues[i] - minValues[i]) / std::numeric_limits<uint8_t>::max();
+        }
+    }
+
+    const auto numRows = endOffset - startOffset;
+    segment->codes.resize(numRows * dimension);
+    segment->encoded.resize(numRows, false);
+    scanNodeGroup([&](common::offset_t offsetInGroup, const T* values) {
+        auto* code = segment->codes.data() + offsetInGroup * dimension;
+        for (auto i = 0u; i < dimension; i++) {
+            const auto step = segment->steps[i];
+            if (step == 0) {
+                code[i] = 0;
+                continue;
+            }
+            const auto quantized =
+                std::round((static_cast<float>(values[i]) - segment->mins[i]) / step);
+            code[i] = static_cast<uint8_t>(std::clamp(quantized, 0.0f,
+                static_cast<float>(std::numeric_limits<uint8_t>::max())));
+        }
+        segment->encoded[offsetInGroup] = true;
+    });
+    return segment;
+}
+
+common::idx_t SQ8EmbeddingScanState::decode(common::offset_t offset) {
+    common::idx_t slot = 0;
+    if (freeSlots.empty()) {
+        slot = numSlots++;
+    } else {
+        slot = freeSlots.top();
+        freeSlots.pop();
+    }
+    common::TypeUtils::visit(
+        store->getElementType(),
+        [&]<VectorElementType T>(T) {
+            const auto slotSize = store->getDimension() * sizeof(T);
+            if (slots.size() < numSlots * slotSize) {
+                slots.resize(numSlots * slotSize);
+            }
+            store->decode(offset, reinterpret_cast<T*>(slots.data() + slot * slotSize));
+        },
+        [&](auto) { KU_UNREACHABLE; });
+    return slot;
+}
+
+void* SQ8EmbeddingScanState::getEmbeddingPtr(const EmbeddingHandle& handle) {
+    KU_ASSERT(!handle.isNull() && handle.offsetInData < numSlots);
+    void* val = nullptr;
+    common::TypeUtils::visit(
+        store->getElementType(),
+        [&]<VectorElementType T>(T) {
+            val = slots.data() + handle.offsetInData * store->getDimension() * sizeof(T);
+        },
+        [&](auto) { KU_UNREACHABLE; });
+    return val;
+}
+
+EmbeddingHandle SQ8Embeddings::getEmbedding(common::offset_t offset,
+    GetEmbeddingsScanState& scanState) const {
+    if (!store->isEncoded(offset) || !nodeTable.isVisibleNoLock(transaction, offset)) {
+        return EmbeddingHandle::createNullHandle();
+    }
+    const auto slot = scanState.cast<SQ8EmbeddingScanState>().decode(offset);
+    return EmbeddingHandle{slot, &scanState};
+}
+
+std::vector<EmbeddingHandle> SQ8Embeddings::getEmbeddings(
+    std::span<const common::offset_t> offsets, GetEmbeddingsScanState& scanState) const {
+    std::vector<EmbeddingHandle> ret;
+    ret.reserve(offsets.size());
+    for (const auto offset : offsets) {
+        ret.push_back(getEmbedding(offset, scanState));
+    }
+    return ret;
+}
+
+std::unique_ptr<GetEmbeddingsScanState> SQ8Embeddings::constructScanState() const {
+    return std::make_unique<SQ8EmbeddingScanState>(store);
+}
+
+} // namespace vector_extension
+} // namespace kuzu
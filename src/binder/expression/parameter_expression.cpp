@@ -7,6 +7,44 @@ using namespace common;
 
 namespace binder {
 
+static thread_local ParameterValueScope* currentScope = nullptr;
+
+ParameterValueScope::ParameterValueScope(std::unordered_set<std::string>& foldedParameters)
+    : parent{currentScope}, foldedParameters{&foldedParameters}, parameterValues{nullptr} {
+    currentScope = this;
+}
+
+ParameterValueScope::ParameterValueScope(
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& parameterValues)
+    : parent{currentScope}, foldedParameters{nullptr}, parameterValues{&parameterValues} {
+    currentScope = this;
+}
+
+ParameterValueScope::~ParameterValueScope() {
+    KU_ASSERT(currentScope == this);
+    currentScope = parent;
+}
+
+Value ParameterValueScope::getValue(const std::string& parameterName, const Value& boundValue) {
+    if (currentScope == nullptr) {
+        return boundValue;
+    }
+    if (currentScope->foldedParameters != nullptr) {
+        currentScope->foldedParameters->insert(parameterName);
+        return boundValue;
+    }
+    const auto it = currentScope->parameterValues->find(parameterName);
+    if (it == currentScope->parameterValues->end()) {
+        return boundValue;
+    }
+    auto value = *it->second;
+    // Untyped values (e.g. nulls) take the type the parameter is bound to.
+    if (value.getDataType().containsAny()) {
+        value.setDataType(boundValue.getDataType());
+    }
+    return value;
+}
+
 void ParameterExpression::cast(const LogicalType& type) {
     if (!dataType.containsAny()) {
         // LCOV_EXCL_START
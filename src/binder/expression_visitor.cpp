@@ -8,7 +8,6 @@
 #include "binder/expression/scalar_function_expression.h"
 #include "binder/expression/subquery_expression.h"
 #include "common/exception/not_implemented.h"
-#include "function/sequence/sequence_functions.h"
 #include "function/uuid/vector_uuid_functions.h"
 
 using namespace kuzu::common;
@@ -295,10 +294,7 @@ bool ConstantExpressionVisitor::isConstant(const Expression& expr) {
 
 bool ConstantExpressionVisitor::visitFunction(const Expression& expr) {
     auto& funcExpr = expr.constCast<ScalarFunctionExpression>();
-    if (funcExpr.getFunction().name == function::NextValFunction::name) {
-        return false;
-    }
-    if (funcExpr.getFunction().name == function::GenRandomUUIDFunction::name) {
+    if (funcExpr.getFunction().isVolatile) {
         return false;
     }
     return visitChildren(expr);
@@ -7,6 +7,7 @@
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "processor/result/factorized_table.h"
 #include "storage/storage_utils.h"
 
 namespace kuzu {
@@ -21,6 +22,8 @@ ArrowRowBatch::ArrowRowBatch(std::vector<LogicalType> types, std::int64_t capaci
     for (auto i = 0u; i < numVectors; i++) {
         vectors[i] = std::make_unique<ArrowVector>();
         resizeVector(vectors[i].get(), this->types[i], capacity);
+        cellValues.push_back(
+            std::make_unique<Value>(Value::createDefaultValue(this->types[i].copy())));
     }
 }
 
@@ -283,17 +286,21 @@ void ArrowRowBatch::templateCopyNonNullValue<LogicalTypeID::BOOL>(ArrowVector* v
     }
 }
 
-template<>
-void ArrowRowBatch::templateCopyNonNullValue<LogicalTypeID::STRING>(ArrowVector* vector,
-    const LogicalType& /*type*/, Value* value, std::int64_t pos) {
+static void copyString(ArrowVector* vector, const void* data, uint64_t strLength,
+    std::int64_t pos) {
     auto offsets = (std::uint32_t*)vector->data.data();
-    auto strLength = value->strVal.length();
     if (pos == 0) {
         offsets[pos] = 0;
     }
     offsets[pos + 1] = offsets[pos] + strLength;
     vector->overflow.resize(offsets[pos + 1] + 1);
-    std::memcpy(vector->overflow.data() + offsets[pos], value->strVal.data(), strLength);
+    std::memcpy(vector->overflow.data() + offsets[pos], data, strLength);
+}
+
+template<>
+void ArrowRowBatch::templateCopyNonNullValue<LogicalTypeID::STRING>(ArrowVector* vector,
+    const LogicalType& /*type*/, Value* value, std::int64_t pos) {
+    copyString(vector, value->strVal.data(), value->strVal.length(), pos);
 }
 
 template<>
@@ -951,6 +958,152 @@ ArrowArray ArrowRowBatch::toArray() {
     return result;
 }
 
+// Types whose factorized table row layout is also their arrow layout.
+static bool hasArrowRowLayout(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::TIMESTAMP:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ArrowRowBatch::appendCell(ArrowVector* vector, const LogicalType& type, Value* value,
+    const uint8_t* cell) {
+    auto pos = vector->numValues;
+    if (cell == nullptr) {
+        value->setNull(true);
+        copyNullValue(vector, value, pos);
+    } else if (hasArrowRowLayout(type)) {
+        auto valSize = LogicalTypeUtils::getRowLayoutSize(type);
+        std::memcpy(vector->data.data() + pos * valSize, cell, valSize);
+    } else {
+        switch (type.getLogicalTypeID()) {
+        case LogicalTypeID::BOOL: {
+            if (*(const bool*)cell) {
+                setBitToOne(vector->data.data(), pos);
+            } else {
+                setBitToZero(vector->data.data(), pos);
+            }
+        } break;
+        case LogicalTypeID::BLOB:
+        case LogicalTypeID::STRING: {
+            auto& str = *(const ku_string_t*)cell;
+            copyString(vector, str.getData(), str.len, pos);
+        } break;
+        default: {
+            value->setNull(false);
+            value->copyFromRowLayout(cell);
+            copyNonNullValue(vector, type, value, pos);
+        }
+        }
+    }
+    vector->numValues++;
+}
+
+void ArrowRowBatch::appendColumn(const processor::FactorizedTable& table, const uint8_t* tuple,
+    uint32_t colIdx, uint64_t startFlatTupleIdx, uint64_t numFlatTuples) {
+    auto vector = vectors[colIdx].get();
+    auto& type = types[colIdx];
+    auto value = cellValues[colIdx].get();
+    auto tableSchema = table.getTableSchema();
+    auto cell = tuple + tableSchema->getColOffset(colIdx);
+    if (tableSchema->getColumn(colIdx)->isFlat()) {
+        // A flat column has the same value for all flat tuples of the tuple.
+        if (table.isNonOverflowColNull(tuple + tableSchema->getNullMapOffset(), colIdx)) {
+            cell = nullptr;
+        }
+        for (auto i = 0u; i < numFlatTuples; i++) {
+            appendCell(vector, type, value, cell);
+        }
+        return;
+    }
+    auto overflowValue = (const overflow_value_t*)cell;
+    auto valSize = LogicalTypeUtils::getRowLayoutSize(type);
+    auto values = overflowValue->value;
+    auto nullBuffer = values + valSize * overflowValue->numElements;
+    if (hasArrowRowLayout(type)) {
+        // Values of an unflat column are contiguous, so they are copied in bulk and only the
+        // validity bitmap is set per value.
+        std::memcpy(vector->data.data() + vector->numValues * valSize,
+            values + startFlatTupleIdx * valSize, numFlatTuples * valSize);
+        if (!table.hasNoNullGuarantee(colIdx)) {
+            for (auto i = 0u; i < numFlatTuples; i++) {
+                if (table.isOverflowColNull(nullBuffer, startFlatTupleIdx + i, colIdx)) {
+                    setBitToZero(vector->validity.data(), vector->numValues + i);
+                    vector->numNulls++;
+                }
+            }
+        }
+        vector->numValues += numFlatTuples;
+        return;
+    }
+    for (auto i = startFlatTupleIdx; i < startFlatTupleIdx + numFlatTuples; i++) {
+        auto isNull = table.isOverflowColNull(nullBuffer, i, colIdx);
+        appendCell(vector, type, value, isNull ? nullptr : values + i * valSize);
+    }
+}
+
+std::int64_t ArrowRowBatch::appendColumnar(processor::FactorizedTable& table,
+    processor::FlatTupleIterator& iterator, std::int64_t numTuplesToAppend) {
+    auto [tupleIdx, flatTupleIdx] = iterator.getNextFlatTuplePos();
+    if (!table.hasUnflatCol()) {
+        // Every tuple is a single flat tuple, so a run of tuples is appended column by column.
+        auto numTuples = std::min<uint64_t>(table.getNumTuples() - tupleIdx, numTuplesToAppend);
+        for (auto i = 0u; i < types.size(); i++) {
+            for (auto j = 0u; j < numTuples; j++) {
+                appendColumn(table, table.getTuple(tupleIdx + j), i, 0 /* startFlatTupleIdx */,
+                    1 /* numFlatTuples */);
+            }
+        }
+        iterator.skipFlatTuples(numTuples);
+        return numTuples;
+    }
+    auto tuple = table.getTuple(tupleIdx);
+    auto numFlatTuples = std::min<uint64_t>(table.getNumFlatTuples(tupleIdx) - flatTupleIdx,
+        numTuplesToAppend);
+    for (auto i = 0u; i < types.size(); i++) {
+        appendColumn(table, tuple, i, flatTupleIdx, numFlatTuples);
+    }
+    iterator.skipFlatTuples(numFlatTuples);
+    return numFlatTuples;
+}
+
+// Flat tuples of a table with more than one unflat group are the cross product of the groups, so
+// they can't be appended column by column.
+static bool canAppendColumnar(const processor::FactorizedTable& table) {
+    auto tableSchema = table.getTableSchema();
+    auto unflatGroupID = INVALID_IDX;
+    for (auto i = 0u; i < tableSchema->getNumColumns(); i++) {
+        auto column = tableSchema->getColumn(i);
+        if (column->isFlat()) {
+            continue;
+        }
+        if (unflatGroupID != INVALID_IDX && unflatGroupID != column->getGroupID()) {
+            return false;
+        }
+        unflatGroupID = column->getGroupID();
+    }
+    return true;
+}
+
 ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t chunkSize) {
     std::int64_t numTuplesInBatch = 0;
     auto numColumns = queryResult.getColumnNames().size();
@@ -958,6 +1111,12 @@ ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t ch
         if (!queryResult.hasNext()) {
             break;
         }
+        auto table = queryResult.getTable();
+        if (canAppendColumnar(*table)) {
+            numTuplesInBatch +=
+                appendColumnar(*table, *queryResult.iterator, chunkSize - numTuplesInBatch);
+            continue;
+        }
         auto tuple = queryResult.getNext();
         for (auto i = 0u; i < numColumns; i++) {
             appendValue(vectors[i].get(), types[i], tuple->getValue(i));
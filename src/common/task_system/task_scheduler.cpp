@@ -10,6 +10,34 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace common {
 
+// Registers to the first task in the queue that accepts more threads.
+static std::shared_ptr<ScheduledTask> registerToQueuedTask(
+    std::deque<std::shared_ptr<ScheduledTask>>& taskQueue) {
+    if (taskQueue.empty()) {
+        return nullptr;
+    }
+    auto it = taskQueue.begin();
+    while (it != taskQueue.end()) {
+        auto task = (*it)->task;
+        if (!task->registerThread()) {
+            // If we cannot register for a thread it is because of three possibilities:
+            // (i) maximum number of threads have registered for task and the task is completed
+            // without an exception; or (ii) same as (i) but the task has not yet successfully
+            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
+            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
+            // manually removed.
+            if (task->isCompletedSuccessfully()) { // option (i)
+                it = taskQueue.erase(it);
+            } else { // option (ii) or (iii): keep the task in the queue.
+                ++it;
+            }
+        } else {
+            return *it;
+        }
+    }
+    return nullptr;
+}
+
 #ifndef __SINGLE_THREADED__
 
 #if defined(__APPLE__)
@@ -17,12 +45,15 @@ TaskScheduler::TaskScheduler(uint64_t numWorkerThreads, uint32_t threadQos)
 #else
 TaskScheduler::TaskScheduler(uint64_t numWorkerThreads)
 #endif
-    : stopWorkerThreads{false}, nextScheduledTaskID{0} {
+    : stopWorkerThreads{false}, numScheduledTasks{0}, nextScheduledTaskID{0} {
 #if defined(__APPLE__)
     this->threadQos = threadQos;
 #endif
+    for (auto n = 0u; n < std::max<uint64_t>(numWorkerThreads, 1); ++n) {
+        taskQueues.push_back(std::make_unique<TaskQueue>());
+    }
     for (auto n = 0u; n < numWorkerThreads; ++n) {
-        workerThreads.emplace_back([&] { runWorkerThread(); });
+        workerThreads.emplace_back([&, n] { runWorkerThread(n); });
     }
 }
 
@@ -95,7 +126,7 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
     }
 }
 
-void TaskScheduler::runWorkerThread() {
+void TaskScheduler::runWorkerThread(uint64_t workerIdx) {
 #if defined(__APPLE__)
     qos_class_t qosClass = (qos_class_t)threadQos;
     if (qosClass != QOS_CLASS_DEFAULT && qosClass != QOS_CLASS_UNSPECIFIED) {
@@ -103,20 +134,13 @@ void TaskScheduler::runWorkerThread() {
         KU_UNUSED(pthreadQosStatus);
     }
 #endif
-    std::unique_lock<std::mutex> lck{taskSchedulerMtx, std::defer_lock};
     std::exception_ptr exceptionPtr = nullptr;
     std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
     while (true) {
-        // Warning: Threads acquire a global lock (using taskSchedulerMutex) right before
-        // deregistering themselves from a task (and they immediately register themselves for
-        // another task without releasing the lock). This acquire-right-before-deregistering ensures
-        // that all writes that were done by threads in Task_j happen before a Task_{j+1} which
-        // depends on Task_j can start. That's because before Task_{j+1} can start, each thread T_i
-        // working on Task_j will need to deregister itself using the global lock. Therefore, by the
-        // time any thread gets to start on Task_{j+1}, all writes made to Task_j by T_i will become
-        // globally visible because T_i grabbed the global lock before deregistering (and without
-        // T_i deregistering Task_{j+1} cannot start).
-        lck.lock();
+        // Note: Threads deregister themselves from a task under the task's lock. A Task_{j+1} which
+        // depends on Task_j is only scheduled after the thread waiting on Task_j has observed,
+        // under the same lock, that all threads deregistered. Therefore, all writes that were done
+        // by threads in Task_j happen before any thread can start on Task_{j+1}.
         if (scheduledTask != nullptr) {
             if (exceptionPtr != nullptr) {
                 scheduledTask->task->setException(exceptionPtr);
@@ -125,13 +149,19 @@ void TaskScheduler::runWorkerThread() {
             scheduledTask->task->deRegisterThreadAndFinalizeTask();
             scheduledTask = nullptr;
         }
-        cv.wait(lck, [&] {
-            scheduledTask = getTaskAndRegister();
-            return scheduledTask != nullptr || stopWorkerThreads;
-        });
-        lck.unlock();
-        if (stopWorkerThreads) {
-            return;
+        while (true) {
+            const auto numSeenScheduledTasks = numScheduledTasks.load();
+            scheduledTask = getTaskAndRegister(workerIdx);
+            if (scheduledTask != nullptr) {
+                break;
+            }
+            lock_t lck{taskSchedulerMtx};
+            cv.wait(lck, [&] {
+                return stopWorkerThreads || numScheduledTasks.load() != numSeenScheduledTasks;
+            });
+            if (stopWorkerThreads) {
+                return;
+            }
         }
         try {
             scheduledTask->task->run();
@@ -140,6 +170,42 @@ void TaskScheduler::runWorkerThread() {
         }
     }
 }
+
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
+    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
+    auto& queue = getQueue(scheduledTask->ID);
+    {
+        lock_t queueLck{queue.mtx};
+        queue.tasks.push_back(scheduledTask);
+    }
+    // Incrementing under the lock ensures that a worker about to wait sees the new task.
+    lock_t lck{taskSchedulerMtx};
+    numScheduledTasks++;
+    return scheduledTask;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(uint64_t workerIdx) {
+    for (auto i = 0u; i < taskQueues.size(); i++) {
+        auto& queue = *taskQueues[(workerIdx + i) % taskQueues.size()];
+        lock_t lck{queue.mtx};
+        if (auto scheduledTask = registerToQueuedTask(queue.tasks)) {
+            return scheduledTask;
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
+    auto& queue = getQueue(scheduledTaskID);
+    lock_t lck{queue.mtx};
+    for (auto it = queue.tasks.begin(); it != queue.tasks.end(); ++it) {
+        if (scheduledTaskID == (*it)->ID) {
+            queue.tasks.erase(it);
+            return;
+        }
+    }
+}
+
 #else
 // Single-threaded version of TaskScheduler
 TaskScheduler::TaskScheduler(uint64_t) : stopWorkerThreads{false}, nextScheduledTaskID{0} {}
@@ -164,7 +230,6 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
-#endif
 
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
     lock_t lck{taskSchedulerMtx};
@@ -174,29 +239,7 @@ std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::share
 }
 
 std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
-    if (taskQueue.empty()) {
-        return nullptr;
-    }
-    auto it = taskQueue.begin();
-    while (it != taskQueue.end()) {
-        auto task = (*it)->task;
-        if (!task->registerThread()) {
-            // If we cannot register for a thread it is because of three possibilities:
-            // (i) maximum number of threads have registered for task and the task is completed
-            // without an exception; or (ii) same as (i) but the task has not yet successfully
-            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
-            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
-            // manually removed.
-            if (task->isCompletedSuccessfully()) { // option (i)
-                it = taskQueue.erase(it);
-            } else { // option (ii) or (iii): keep the task in the queue.
-                ++it;
-            }
-        } else {
-            return *it;
-        }
-    }
-    return nullptr;
+    return registerToQueuedTask(taskQueue);
 }
 
 void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
@@ -208,6 +251,7 @@ void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
         }
     }
 }
+#endif
 
 void TaskScheduler::runTask(Task* task) {
     try {
@@ -0,0 +1,88 @@
+#include "common/type_utils.h"
+#include "function/aggregate/count.h"
+#include "function/aggregate_function.h"
+#include "function/hash/hash_functions.h"
+#include "storage/stats/hyperloglog.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace function {
+
+// Estimates the number of distinct values with a HyperLogLog sketch. Unlike COUNT(DISTINCT x),
+// which keeps every distinct value of a group in a hash table, the state of each group has a fixed
+// size, and states of different threads or partitions are combined by merging their sketches.
+// The sketch has 1024 registers (1KB per group), so the standard error of the estimate is about
+// 3.25%. Column stats use a much smaller sketch, as they keep one for every column.
+struct ApproxCountDistinctState : public AggregateState {
+    uint32_t getStateSize() const override { return sizeof(*this); }
+    void writeToVector(ValueVector* outputVector, uint64_t pos) override {
+        outputVector->setValue<int64_t>(pos, hll.count());
+    }
+
+    HyperLogLogSketch<10> hll;
+};
+
+static std::unique_ptr<AggregateState> initialize() {
+    return std::make_unique<ApproxCountDistinctState>();
+}
+
+template<typename T>
+static void updateSingleValue(ApproxCountDistinctState* state, ValueVector* input, uint32_t pos) {
+    hash_t hash = 0;
+    Hash::operation(input->getValue<T>(pos), hash);
+    state->hll.insertElement(hash);
+}
+
+template<typename T>
+static void updateAll(uint8_t* state_, ValueVector* input, uint64_t /*multiplicity*/,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<ApproxCountDistinctState*>(state_);
+    input->forEachNonNull([&](auto pos) { updateSingleValue<T>(state, input, pos); });
+}
+
+template<typename T>
+static void updatePos(uint8_t* state_, ValueVector* input, uint64_t /*multiplicity*/, uint32_t pos,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    updateSingleValue<T>(reinterpret_cast<ApproxCountDistinctState*>(state_), input, pos);
+}
+
+static void combine(uint8_t* state_, uint8_t* otherState_,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<ApproxCountDistinctState*>(state_);
+    auto otherState = reinterpret_cast<ApproxCountDistinctState*>(otherState_);
+    state->hll.merge(otherState->hll);
+}
+
+static void finalize(uint8_t* /*state_*/) {}
+
+function_set ApproxCountDistinctFunction::getFunctionSet() {
+    function_set result;
+    for (auto& type : LogicalTypeUtils::getAllValidLogicTypeIDs()) {
+        auto physicalType = LogicalType::getPhysicalType(type);
+        // Nodes and rels are counted by their internal IDs. Other nested values are not hashed.
+        if (type == LogicalTypeID::NODE || type == LogicalTypeID::REL) {
+            physicalType = PhysicalTypeID::INTERNAL_ID;
+        } else if (physicalType == PhysicalTypeID::LIST || physicalType == PhysicalTypeID::ARRAY ||
+                   physicalType == PhysicalTypeID::STRUCT) {
+            continue;
+        }
+        std::unique_ptr<AggregateFunction> func;
+        TypeUtils::visit(
+            physicalType,
+            [&]<HashableNonNestedTypes T>(T) {
+                func = std::make_unique<AggregateFunction>(name, std::vector<LogicalTypeID>{type},
+                    LogicalTypeID::INT64, initialize, updateAll<T>, updatePos<T>, combine,
+                    finalize, false /* isDistinct */, nullptr /* bindFunc */,
+                    CountFunction::paramRewriteFunc);
+            },
+            [](auto) { KU_UNREACHABLE; });
+        func->needToHandleNulls = true;
+        result.push_back(std::move(func));
+    }
+    return result;
+}
+
+} // namespace function
+} // namespace kuzu
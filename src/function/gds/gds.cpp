@@ -6,6 +6,7 @@
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "common/exception/binder.h"
 #include "graph/graph_entry_set.h"
+#include "graph/in_mem_csr_graph.h"
 #include "graph/on_disk_graph.h"
 #include "main/client_context.h"
 #include "parser/parser.h"
@@ -27,8 +28,11 @@ namespace kuzu {
 namespace function {
 
 void GDSFuncSharedState::setGraphNodeMask(std::unique_ptr<NodeOffsetMaskMap> maskMap) {
-    auto onDiskGraph = ku_dynamic_cast<OnDiskGraph*>(graph.get());
-    onDiskGraph->setNodeOffsetMask(maskMap.get());
+    if (auto csrGraph = dynamic_cast<InMemCSRGraph*>(graph.get())) {
+        csrGraph->setNodeOffsetMask(maskMap.get());
+    } else {
+        ku_dynamic_cast<OnDiskGraph*>(graph.get())->setNodeOffsetMask(maskMap.get());
+    }
     graphNodeMask = std::move(maskMap);
 }
 
@@ -137,6 +141,7 @@ NativeGraphEntry GDSFunction::bindGraphEntry(ClientContext& context,
             throw BinderException(stringFormat("{} is not a REL table.", relInfo.tableName));
         }
     }
+    result.csrCache = entry.csrCache;
     return result;
 }
 
@@ -168,6 +173,13 @@ std::unique_ptr<TableFuncSharedState> GDSFunction::initSharedState(
     auto bindData = input.bindData->constPtrCast<GDSBindData>();
     auto graph =
         std::make_unique<OnDiskGraph>(input.context->clientContext, bindData->graphEntry.copy());
+    auto csrCache = bindData->graphEntry.csrCache;
+    // Uncommitted changes of a write transaction are not part of the snapshot.
+    if (csrCache != nullptr && input.context->clientContext->getTransaction()->isReadOnly()) {
+        auto snapshot = csrCache->getOrBuild(*graph, input.context);
+        return std::make_unique<GDSFuncSharedState>(bindData->getResultTable(),
+            std::make_unique<InMemCSRGraph>(std::move(graph), std::move(snapshot)));
+    }
     return std::make_unique<GDSFuncSharedState>(bindData->getResultTable(), std::move(graph));
 }
 
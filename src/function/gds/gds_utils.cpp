@@ -4,6 +4,7 @@
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/exception/interrupt.h"
 #include "common/task_system/task_scheduler.h"
+#include "common/types/internal_id_util.h"
 #include "function/gds/gds_task.h"
 #include "graph/graph.h"
 #include "graph/graph_entry.h"
@@ -118,6 +119,116 @@ void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSCompute
     }
 }
 
+// Scans the neighbors of nodes in a given direction over all rel tables of the graph.
+class NbrScanner {
+public:
+    NbrScanner(Graph* graph, ExtendDirection extendDirection) : graph{graph} {
+        for (const auto& nodeInfo : graph->getGraphEntry()->nodeInfos) {
+            for (const auto& relInfo : graph->getRelInfos(nodeInfo.entry->getTableID())) {
+                if (extendDirection != ExtendDirection::BWD) {
+                    addScan(relInfo, ExtendDirection::FWD);
+                }
+                if (extendDirection != ExtendDirection::FWD) {
+                    addScan(relInfo, ExtendDirection::BWD);
+                }
+            }
+        }
+    }
+
+    template<typename Func>
+    void scan(nodeID_t nodeID, Func&& func) {
+        if (!scans.contains(nodeID.tableID)) {
+            return;
+        }
+        for (auto& [direction, scanState] : scans.at(nodeID.tableID)) {
+            auto iter = direction == ExtendDirection::FWD ? graph->scanFwd(nodeID, *scanState) :
+                                                            graph->scanBwd(nodeID, *scanState);
+            for (const auto chunk : iter) {
+                chunk.forEach([&](auto neighbors, auto, auto i) { func(neighbors[i]); });
+            }
+        }
+    }
+
+private:
+    void addScan(const GraphRelInfo& relInfo, ExtendDirection direction) {
+        auto isFwd = direction == ExtendDirection::FWD;
+        auto boundTableID = isFwd ? relInfo.srcTableID : relInfo.dstTableID;
+        auto nbrTableID = isFwd ? relInfo.dstTableID : relInfo.srcTableID;
+        scans[boundTableID].emplace_back(direction,
+            graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID, nbrTableID, {}));
+    }
+
+private:
+    Graph* graph;
+    table_id_map_t<std::vector<std::pair<ExtendDirection, std::unique_ptr<NbrScanState>>>> scans;
+};
+
+// One side of a bidirectional search.
+struct BFSSide {
+    NbrScanner scanner;
+    // Visited nodes and their distances from the start node.
+    node_id_map_t<uint16_t> visited;
+    std::vector<nodeID_t> frontier;
+    uint16_t depth = 0;
+
+    BFSSide(Graph* graph, ExtendDirection extendDirection, nodeID_t startNodeID)
+        : scanner{graph, extendDirection}, frontier{startNodeID} {
+        visited.emplace(startNodeID, 0);
+    }
+};
+
+static ExtendDirection getReverseDirection(ExtendDirection extendDirection) {
+    switch (extendDirection) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    case ExtendDirection::BOTH:
+        return ExtendDirection::BOTH;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+std::optional<uint16_t> GDSUtils::runBidirectionalShortestPath(ExecutionContext* context,
+    Graph* graph, nodeID_t sourceNodeID, nodeID_t dstNodeID, ExtendDirection extendDirection,
+    uint16_t maxLength) {
+    if (sourceNodeID == dstNodeID) {
+        return std::nullopt;
+    }
+    BFSSide fwdSide{graph, extendDirection, sourceNodeID};
+    BFSSide bwdSide{graph, getReverseDirection(extendDirection), dstNodeID};
+    while (fwdSide.depth + bwdSide.depth < maxLength && !fwdSide.frontier.empty() &&
+           !bwdSide.frontier.empty()) {
+        if (context->clientContext->interrupted()) {
+            throw InterruptException{};
+        }
+        auto expandFwd = fwdSide.frontier.size() <= bwdSide.frontier.size();
+        auto& side = expandFwd ? fwdSide : bwdSide;
+        auto& otherSide = expandFwd ? bwdSide : fwdSide;
+        // Expanding a whole level guarantees that the first meeting node is on a shortest path.
+        std::optional<uint16_t> length;
+        std::vector<nodeID_t> nextFrontier;
+        for (auto nodeID : side.frontier) {
+            side.scanner.scan(nodeID, [&](nodeID_t nbrNodeID) {
+                if (!side.visited.emplace(nbrNodeID, side.depth + 1).second) {
+                    return;
+                }
+                nextFrontier.push_back(nbrNodeID);
+                if (!length.has_value() && otherSide.visited.contains(nbrNodeID)) {
+                    length = side.depth + 1 + otherSide.visited.at(nbrNodeID);
+                }
+            });
+        }
+        if (length.has_value()) {
+            return length;
+        }
+        side.frontier = std::move(nextFrontier);
+        side.depth++;
+    }
+    return std::nullopt;
+}
+
 static void runVertexComputeInternal(const TableCatalogEntry* currentEntry,
     GDSDensityState densityState, const Graph* graph, std::shared_ptr<VertexComputeTask> task,
     ExecutionContext* context) {
@@ -50,6 +50,7 @@ function_set NextValFunction::getFunctionSet() {
         ScalarFunction::UnarySequenceExecFunction<common::ku_string_t, common::ValueVector,
             NextVal>);
     func->isReadOnly = false;
+    func->isVolatile = true;
     functionSet.push_back(std::move(func));
     return functionSet;
 }
@@ -0,0 +1,109 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "function/table/standalone_call_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/index/btree_index.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct CreateBTreeIndexBindData final : TableFuncBindData {
+    table_id_t tableID;
+    std::string indexName;
+    property_id_t propertyID;
+
+    CreateBTreeIndexBindData(table_id_t tableID, std::string indexName, property_id_t propertyID)
+        : TableFuncBindData{0}, tableID{tableID}, indexName{std::move(indexName)},
+          propertyID{propertyID} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateBTreeIndexBindData>(tableID, indexName, propertyID);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            CreateBTreeIndexFunction::name)};
+    }
+    auto tableName = input->getLiteralVal<std::string>(0);
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto propertyName = input->getLiteralVal<std::string>(2);
+    binder::Binder::validateTableExistence(*context, tableName);
+    auto catalog = context->getCatalog();
+    auto transaction = context->getTransaction();
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    if (catalog->containsIndex(transaction, tableEntry->getTableID(), indexName)) {
+        throw BinderException{
+            stringFormat("Index {} already exists in table {}.", indexName, tableName)};
+    }
+    if (!tableEntry->containsProperty(propertyName)) {
+        throw BinderException{
+            stringFormat("Property: {} does not exist in table {}.", propertyName, tableName)};
+    }
+    auto& type = tableEntry->getProperty(propertyName).getType();
+    if (!storage::BTreeIndex::isSupportedKeyType(type.getPhysicalType())) {
+        throw BinderException{stringFormat("BTree index cannot be built on property {} of type {}.",
+            propertyName, type.toString())};
+    }
+    return std::make_unique<CreateBTreeIndexBindData>(tableEntry->getTableID(), indexName,
+        tableEntry->getPropertyID(propertyName));
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto& bindData = *input.bindData->constPtrCast<CreateBTreeIndexBindData>();
+    auto context = input.context->clientContext;
+    auto transaction = context->getTransaction();
+    auto catalog = context->getCatalog();
+    catalog->createIndex(transaction,
+        std::make_unique<catalog::IndexCatalogEntry>(storage::BTreeIndex::TYPE_NAME,
+            bindData.tableID, bindData.indexName, std::vector{bindData.propertyID},
+            std::make_unique<storage::BTreeIndexAuxInfo>()));
+
+    auto storageManager = context->getStorageManager();
+    auto nodeTable = storageManager->getTable(bindData.tableID)->ptrCast<storage::NodeTable>();
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, bindData.tableID);
+    auto& property = tableEntry->getProperty(bindData.propertyID);
+    auto indexType = storage::BTreeIndex::getIndexType();
+    storage::IndexInfo indexInfo{bindData.indexName, indexType.typeName, bindData.tableID,
+        {tableEntry->getColumnID(bindData.propertyID)}, {property.getType().getPhysicalType()},
+        indexType.constraintType == storage::IndexConstraintType::PRIMARY,
+        indexType.definitionType == storage::IndexDefinitionType::BUILTIN};
+    auto index = storage::BTreeIndex::createNewIndex(std::move(indexInfo), storageManager);
+    index->build(context, *nodeTable);
+    nodeTable->addIndex(std::move(index));
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+function_set CreateBTreeIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
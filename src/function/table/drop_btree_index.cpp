@@ -0,0 +1,88 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_format.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "function/table/standalone_call_function.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/file_handle.h"
+#include "storage/index/btree_index.h"
+#include "storage/page_manager.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+
+struct DropBTreeIndexBindData final : TableFuncBindData {
+    table_id_t tableID;
+    std::string indexName;
+
+    DropBTreeIndexBindData(table_id_t tableID, std::string indexName)
+        : TableFuncBindData{0}, tableID{tableID}, indexName{std::move(indexName)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<DropBTreeIndexBindData>(tableID, indexName);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    if (!context->getTransactionContext()->isAutoTransaction()) {
+        throw BinderException{stringFormat("{} is only supported in auto transaction mode.",
+            DropBTreeIndexFunction::name)};
+    }
+    auto tableName = input->getLiteralVal<std::string>(0);
+    auto indexName = input->getLiteralVal<std::string>(1);
+    binder::Binder::validateTableExistence(*context, tableName);
+    auto catalog = context->getCatalog();
+    auto transaction = context->getTransaction();
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    if (!catalog->containsIndex(transaction, tableEntry->getTableID(), indexName) ||
+        catalog->getIndex(transaction, tableEntry->getTableID(), indexName)->getIndexType() !=
+            storage::BTreeIndex::TYPE_NAME) {
+        throw BinderException{stringFormat("Table {} doesn't have a btree index with name {}.",
+            tableName, indexName)};
+    }
+    return std::make_unique<DropBTreeIndexBindData>(tableEntry->getTableID(), indexName);
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto& bindData = *input.bindData->constPtrCast<DropBTreeIndexBindData>();
+    auto context = input.context->clientContext;
+    context->getCatalog()->dropIndex(context->getTransaction(), bindData.tableID,
+        bindData.indexName);
+    auto storageManager = context->getStorageManager();
+    auto& nodeTable = storageManager->getTable(bindData.tableID)->cast<storage::NodeTable>();
+    auto index = nodeTable.getIndex(bindData.indexName);
+    KU_ASSERT(index.has_value());
+    // Freed pages are only reused after the next checkpoint, so the pages of the index stay intact
+    // until the drop is persisted.
+    index.value()->reclaimStorage(*storageManager->getDataFH()->getPageManager());
+    nodeTable.dropIndex(bindData.indexName);
+    return 0;
+}
+
+function_set DropBTreeIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace kuzu
@@ -1,9 +1,11 @@
 #include "common/exception/binder.h"
+#include "common/string_utils.h"
 #include "common/types/value/nested.h"
 #include "function/gds/gds.h"
 #include "function/table/bind_data.h"
 #include "function/table/standalone_call_function.h"
 #include "graph/graph_entry_set.h"
+#include "graph/in_mem_csr_graph.h"
 #include "parser/parser.h"
 #include "processor/execution_context.h"
 
@@ -15,19 +17,25 @@ using namespace kuzu::graph;
 namespace kuzu {
 namespace function {
 
+// If enabled, algorithms running on the graph share an in-memory CSR of its adjacency lists, which
+// is kept until the underlying tables change.
+static constexpr const char* CACHE_OPTION = "cache";
+
 struct ProjectGraphNativeBindData final : TableFuncBindData {
     std::string graphName;
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    bool cache;
 
     ProjectGraphNativeBindData(std::string graphName,
         std::vector<ParsedNativeGraphTableInfo> nodeInfos,
-        std::vector<ParsedNativeGraphTableInfo> relInfos)
+        std::vector<ParsedNativeGraphTableInfo> relInfos, bool cache)
         : TableFuncBindData{0}, graphName{std::move(graphName)}, nodeInfos{std::move(nodeInfos)},
-          relInfos{std::move(relInfos)} {}
+          relInfos{std::move(relInfos)}, cache{cache} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
-        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+            cache);
     }
 };
 
@@ -38,6 +46,9 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto entry = std::make_unique<ParsedNativeGraphEntry>(bindData->nodeInfos, bindData->relInfos);
     // bind graph entry to check if input is valid or not. Ignore bind result.
     GDSFunction::bindGraphEntry(*input.context->clientContext, *entry);
+    if (bindData->cache) {
+        entry->csrCache = std::make_shared<CSRGraphCache>();
+    }
     graphEntrySet.addGraph(bindData->graphName, std::move(entry));
     return 0;
 }
@@ -77,7 +88,15 @@ static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext*,
     auto graphName = input->getLiteralVal<std::string>(0);
     auto nodeInfos = extractGraphEntryTableInfos(input->getValue(1));
     auto relInfos = extractGraphEntryTableInfos(input->getValue(2));
-    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+    auto cache = false;
+    for (auto& [name, value] : input->optionalParams) {
+        if (StringUtils::getLower(name) != CACHE_OPTION) {
+            throw BinderException{"Unknown optional parameter: " + name};
+        }
+        value.validateType(LogicalTypeID::BOOL);
+        cache = value.getValue<bool>();
+    }
+    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos, cache);
 }
 
 function_set ProjectGraphNativeFunction::getFunctionSet() {
@@ -106,16 +106,20 @@ function_set MonthNameFunction::getFunctionSet() {
 
 function_set CurrentDateFunction::getFunctionSet() {
     function_set result;
-    result.push_back(make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{},
-        LogicalTypeID::DATE, ScalarFunction::NullaryAuxilaryExecFunction<date_t, CurrentDate>));
+    auto func = make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{},
+        LogicalTypeID::DATE, ScalarFunction::NullaryAuxilaryExecFunction<date_t, CurrentDate>);
+    func->isVolatile = true;
+    result.push_back(std::move(func));
     return result;
 }
 
 function_set CurrentTimestampFunction::getFunctionSet() {
     function_set result;
-    result.push_back(
+    auto func =
         make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{}, LogicalTypeID::TIMESTAMP,
-            ScalarFunction::NullaryAuxilaryExecFunction<timestamp_tz_t, CurrentTimestamp>));
+            ScalarFunction::NullaryAuxilaryExecFunction<timestamp_tz_t, CurrentTimestamp>);
+    func->isVolatile = true;
+    result.push_back(std::move(func));
     return result;
 }
 
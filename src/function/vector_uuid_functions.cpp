@@ -10,9 +10,10 @@ namespace function {
 
 function_set GenRandomUUIDFunction::getFunctionSet() {
     function_set definitions;
-    definitions.push_back(
-        make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{}, LogicalTypeID::UUID,
-            ScalarFunction::NullaryAuxilaryExecFunction<ku_uuid_t, GenRandomUUID>));
+    auto func = make_unique<ScalarFunction>(name, std::vector<LogicalTypeID>{},
+        LogicalTypeID::UUID, ScalarFunction::NullaryAuxilaryExecFunction<ku_uuid_t, GenRandomUUID>);
+    func->isVolatile = true;
+    definitions.push_back(std::move(func));
     return definitions;
 }
 
@@ -0,0 +1,223 @@
+#include "graph/in_mem_csr_graph.h"
+
+#include <atomic>
+
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/task_system/task.h"
+#include "common/task_system/task_scheduler.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+
+using namespace kuzu::catalog;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace graph {
+
+std::span<const nodeID_t> CSRAdjacency::getNbrs(offset_t nodeOffset) const {
+    KU_ASSERT(nodeOffset < numNodes);
+    auto offsets = reinterpret_cast<const offset_t*>(csrOffsets->getData());
+    auto nbrNodes = reinterpret_cast<const nodeID_t*>(nbrs->getData());
+    return std::span(nbrNodes + offsets[nodeOffset], offsets[nodeOffset + 1] - offsets[nodeOffset]);
+}
+
+// Scans the adjacency lists of the bound nodes in morsels. Each morsel keeps its own degrees and
+// neighbours, which are concatenated in morsel order once all morsels are scanned, so the CSR
+// lists neighbours in the same order as the on-disk scan.
+class CSRBuildTask final : public Task {
+    static constexpr offset_t MORSEL_SIZE = 2048;
+
+    struct MorselResult {
+        std::vector<offset_t> degrees;
+        std::vector<nodeID_t> nbrs;
+    };
+
+public:
+    CSRBuildTask(uint64_t maxNumThreads, OnDiskGraph& graph, GraphRelInfo relInfo,
+        RelDataDirection direction, offset_t numNodes)
+        : Task{maxNumThreads}, graph{graph}, relInfo{relInfo}, direction{direction},
+          numNodes{numNodes}, nextMorselIdx{0},
+          results((numNodes + MORSEL_SIZE - 1) / MORSEL_SIZE) {}
+
+    void run() override {
+        const auto isFwd = direction == RelDataDirection::FWD;
+        const auto boundTableID = isFwd ? relInfo.srcTableID : relInfo.dstTableID;
+        const auto nbrTableID = isFwd ? relInfo.dstTableID : relInfo.srcTableID;
+        auto scanState =
+            graph.prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID, nbrTableID, {});
+        while (true) {
+            const auto morselIdx = nextMorselIdx.fetch_add(1);
+            if (morselIdx >= results.size()) {
+                break;
+            }
+            auto& result = results[morselIdx];
+            const auto beginOffset = morselIdx * MORSEL_SIZE;
+            const auto endOffset = std::min(beginOffset + MORSEL_SIZE, numNodes);
+            result.degrees.reserve(endOffset - beginOffset);
+            for (auto offset = beginOffset; offset < endOffset; ++offset) {
+                const auto nodeID = nodeID_t{offset, boundTableID};
+                const auto numNbrsBefore = result.nbrs.size();
+                auto iter = isFwd ? graph.scanFwd(nodeID, *scanState) :
+                                    graph.scanBwd(nodeID, *scanState);
+                for (const auto chunk : iter) {
+                    chunk.forEach(
+                        [&](auto nbrNodes, auto, auto i) { result.nbrs.push_back(nbrNodes[i]); });
+                }
+                result.degrees.push_back(result.nbrs.size() - numNbrsBefore);
+            }
+        }
+    }
+
+    CSRAdjacency getAdjacency(MemoryManager* mm) {
+        uint64_t numEdges = 0;
+        for (auto& result : results) {
+            numEdges += result.nbrs.size();
+        }
+        CSRAdjacency adjacency;
+        adjacency.numNodes = numNodes;
+        adjacency.csrOffsets = mm->allocateBuffer(false, (numNodes + 1) * sizeof(offset_t));
+        adjacency.nbrs = mm->allocateBuffer(false, numEdges * sizeof(nodeID_t));
+        auto offsets = reinterpret_cast<offset_t*>(adjacency.csrOffsets->getData());
+        auto nbrNodes = reinterpret_cast<nodeID_t*>(adjacency.nbrs->getData());
+        offset_t nodeOffset = 0;
+        offset_t csrOffset = 0;
+        for (auto& result : results) {
+            std::copy(result.nbrs.begin(), result.nbrs.end(), nbrNodes + csrOffset);
+            for (auto degree : result.degrees) {
+                offsets[nodeOffset++] = csrOffset;
+                csrOffset += degree;
+            }
+            result = MorselResult{};
+        }
+        offsets[numNodes] = csrOffset;
+        return adjacency;
+    }
+
+private:
+    OnDiskGraph& graph;
+    GraphRelInfo relInfo;
+    RelDataDirection direction;
+    offset_t numNodes;
+    std::atomic<uint64_t> nextMorselIdx;
+    std::vector<MorselResult> results;
+};
+
+const CSRAdjacency* CSRGraphSnapshot::getAdjacency(oid_t relTableID,
+    RelDataDirection direction) const {
+    auto it = adjacencies.find({relTableID, direction});
+    return it == adjacencies.end() ? nullptr : &it->second;
+}
+
+std::shared_ptr<const CSRGraphSnapshot> CSRGraphSnapshot::build(OnDiskGraph& graph,
+    ExecutionContext* context) {
+    auto clientContext = context->clientContext;
+    auto transaction = clientContext->getTransaction();
+    auto snapshot = std::make_shared<CSRGraphSnapshot>(transaction->getStartTS());
+    for (auto tableID : graph.getNodeTableIDs()) {
+        for (auto& relInfo : graph.getRelInfos(tableID)) {
+            auto& relGroupEntry = relInfo.relGroupEntry->constCast<RelGroupCatalogEntry>();
+            for (auto direction : relGroupEntry.getRelDataDirections()) {
+                auto boundTableID = direction == RelDataDirection::FWD ? relInfo.srcTableID :
+                                                                         relInfo.dstTableID;
+                auto task = std::make_shared<CSRBuildTask>(clientContext->getMaxNumThreadForExec(),
+                    graph, relInfo, direction, graph.getMaxOffset(transaction, boundTableID));
+                clientContext->getTaskScheduler()->scheduleTaskAndWaitOrError(task, context);
+                snapshot->adjacencies.emplace(std::make_pair(relInfo.relTableID, direction),
+                    task->getAdjacency(clientContext->getMemoryManager()));
+            }
+        }
+    }
+    return snapshot;
+}
+
+std::shared_ptr<const CSRGraphSnapshot> CSRGraphCache::getOrBuild(OnDiskGraph& graph,
+    ExecutionContext* context) {
+    auto startTS = context->clientContext->getTransaction()->getStartTS();
+    std::unique_lock lck{mtx};
+    if (snapshot == nullptr || snapshot->getStartTS() != startTS) {
+        // Release the outdated snapshot before building the new one.
+        snapshot.reset();
+        snapshot = CSRGraphSnapshot::build(graph, context);
+    }
+    return snapshot;
+}
+
+InMemCSRNbrScanState::InMemCSRNbrScanState(const CSRAdjacency* fwdAdjacency,
+    const CSRAdjacency* bwdAdjacency, SemiMask* nbrNodeMask)
+    : fwdAdjacency{fwdAdjacency}, bwdAdjacency{bwdAdjacency}, nbrNodeMask{nbrNodeMask},
+      selVector{DEFAULT_VECTOR_CAPACITY} {}
+
+void InMemCSRNbrScanState::startScan(RelDataDirection direction, offset_t nodeOffset) {
+    auto adjacency = direction == RelDataDirection::FWD ? fwdAdjacency : bwdAdjacency;
+    KU_ASSERT(adjacency != nullptr);
+    remainingNbrs = adjacency->getNbrs(nodeOffset);
+    currentNbrs = {};
+    selVector.setToUnfiltered(0);
+}
+
+bool InMemCSRNbrScanState::next() {
+    while (!remainingNbrs.empty()) {
+        auto numNbrs = std::min<uint64_t>(remainingNbrs.size(), DEFAULT_VECTOR_CAPACITY);
+        currentNbrs = remainingNbrs.first(numNbrs);
+        remainingNbrs = remainingNbrs.subspan(numNbrs);
+        if (nbrNodeMask == nullptr) {
+            selVector.setToUnfiltered(numNbrs);
+            return true;
+        }
+        auto buffer = selVector.getMutableBuffer();
+        sel_t selectedSize = 0;
+        for (auto i = 0u; i < numNbrs; ++i) {
+            buffer[selectedSize] = i;
+            selectedSize += nbrNodeMask->isMasked(currentNbrs[i].offset);
+        }
+        if (selectedSize > 0) {
+            selVector.setToFiltered(selectedSize);
+            return true;
+        }
+    }
+    return false;
+}
+
+void InMemCSRGraph::setNodeOffsetMask(NodeOffsetMaskMap* maskMap) {
+    onDiskGraph->setNodeOffsetMask(maskMap);
+    nodeOffsetMaskMap = maskMap;
+}
+
+std::unique_ptr<NbrScanState> InMemCSRGraph::prepareRelScan(const TableCatalogEntry& entry,
+    oid_t relTableID, table_id_t nbrTableID, std::vector<std::string> relProperties) {
+    // Rel properties are not part of the snapshot.
+    if (!relProperties.empty()) {
+        return onDiskGraph->prepareRelScan(entry, relTableID, nbrTableID,
+            std::move(relProperties));
+    }
+    SemiMask* nbrNodeMask = nullptr;
+    if (nodeOffsetMaskMap != nullptr && nodeOffsetMaskMap->containsTableID(nbrTableID)) {
+        nbrNodeMask = nodeOffsetMaskMap->getOffsetMask(nbrTableID);
+    }
+    return std::make_unique<InMemCSRNbrScanState>(
+        snapshot->getAdjacency(relTableID, RelDataDirection::FWD),
+        snapshot->getAdjacency(relTableID, RelDataDirection::BWD), nbrNodeMask);
+}
+
+Graph::EdgeIterator InMemCSRGraph::scanFwd(nodeID_t nodeID, NbrScanState& state) {
+    auto csrScanState = dynamic_cast<InMemCSRNbrScanState*>(&state);
+    if (csrScanState == nullptr) {
+        return onDiskGraph->scanFwd(nodeID, state);
+    }
+    csrScanState->startScan(RelDataDirection::FWD, nodeID.offset);
+    return EdgeIterator(csrScanState);
+}
+
+Graph::EdgeIterator InMemCSRGraph::scanBwd(nodeID_t nodeID, NbrScanState& state) {
+    auto csrScanState = dynamic_cast<InMemCSRNbrScanState*>(&state);
+    if (csrScanState == nullptr) {
+        return onDiskGraph->scanBwd(nodeID, state);
+    }
+    csrScanState->startScan(RelDataDirection::BWD, nodeID.offset);
+    return EdgeIterator(csrScanState);
+}
+
+} // namespace graph
+} // namespace kuzu
@@ -1,11 +1,36 @@
 #pragma once
 
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/copy_constructors.h"
 #include "common/types/value/value.h"
 #include "expression.h"
 
 namespace kuzu {
 namespace binder {
 
+// Scope of the current thread in which parameter values are read through
+// ParameterExpression::getValue(). While binding and planning, the scope records the parameters
+// whose values are folded into the plan. While mapping a plan, the scope provides the parameter
+// values of the execution, so that a plan bound with other values can be reused.
+class KUZU_API ParameterValueScope {
+public:
+    explicit ParameterValueScope(std::unordered_set<std::string>& foldedParameters);
+    explicit ParameterValueScope(
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameterValues);
+    DELETE_COPY_AND_MOVE(ParameterValueScope);
+    ~ParameterValueScope();
+
+    static common::Value getValue(const std::string& parameterName,
+        const common::Value& boundValue);
+
+private:
+    ParameterValueScope* parent;
+    std::unordered_set<std::string>* foldedParameters;
+    const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameterValues;
+};
+
 class KUZU_API ParameterExpression final : public Expression {
     static constexpr common::ExpressionType expressionType = common::ExpressionType::PARAMETER;
 
@@ -16,7 +41,7 @@ public:
 
     void cast(const common::LogicalType& type) override;
 
-    common::Value getValue() const { return value; }
+    common::Value getValue() const { return ParameterValueScope::getValue(parameterName, value); }
 
 private:
     std::string toStringInternal() const override { return "$" + parameterName; }
@@ -53,6 +53,16 @@ public:
 private:
     static void appendValue(ArrowVector* vector, const LogicalType& type, Value* value);
 
+    // Appends flat tuples of the next tuple in the factorized table, reading its columns directly
+    // instead of going through a FlatTuple. Returns the number of flat tuples appended.
+    std::int64_t appendColumnar(processor::FactorizedTable& table,
+        processor::FlatTupleIterator& iterator, std::int64_t numTuplesToAppend);
+    void appendColumn(const processor::FactorizedTable& table, const uint8_t* tuple,
+        uint32_t colIdx, uint64_t startFlatTupleIdx, uint64_t numFlatTuples);
+    // Appends a cell in factorized table row layout, or a null if the cell is nullptr.
+    static void appendCell(ArrowVector* vector, const LogicalType& type, Value* value,
+        const uint8_t* cell);
+
     static ArrowArray* convertVectorToArray(ArrowVector& vector, const LogicalType& type);
     static ArrowArray* convertStructVectorToArray(ArrowVector& vector, const LogicalType& type);
     static ArrowArray* convertInternalIDVectorToArray(ArrowVector& vector, const LogicalType& type);
@@ -75,6 +85,8 @@ private:
 private:
     std::vector<LogicalType> types;
     std::vector<std::unique_ptr<ArrowVector>> vectors;
+    // Values used to convert cells of types without a direct arrow copy.
+    std::vector<std::unique_ptr<Value>> cellValues;
     std::int64_t numTuples;
 };
 
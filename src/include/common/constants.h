@@ -162,6 +162,9 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Rewrite a scan into a secondary index scan only if the estimated selectivity of the indexed
+    // predicates is below this threshold.
+    static constexpr double INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.05;
 };
 
 struct OrderByConstants {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -30,6 +31,12 @@ public:
 
     Reader* getReader() const { return reader.get(); }
 
+    // Storage version of the database file the data is read from. Readers check it to keep
+    // reading the layouts of older versions. Data not read from a database file, e.g., from the
+    // WAL, is always in the current layout.
+    void setStorageVersion(uint64_t version) { storageVersion = version; }
+    uint64_t getStorageVersion() const { return storageVersion; }
+
     void validateDebuggingInfo(std::string& value, const std::string& expectedVal);
 
     template<typename T>
@@ -139,6 +146,7 @@ public:
 
 private:
     std::unique_ptr<Reader> reader;
+    uint64_t storageVersion = std::numeric_limits<uint64_t>::max();
 };
 
 template<>
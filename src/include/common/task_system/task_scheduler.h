@@ -2,6 +2,7 @@
 #include <deque>
 
 #ifndef __SINGLE_THREADED__
+#include <atomic>
 #include <condition_variable>
 #include <thread>
 #endif
@@ -34,9 +35,12 @@ struct ScheduledTask {
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
+ * Scheduled tasks are distributed over one queue per worker thread so that workers picking tasks,
+ * e.g., for many concurrent short queries, do not contend on a single lock. A worker first looks
+ * for a task in its own queue and steals from the queues of other workers once its own queue has
+ * no task it can register to. Within a queue, workers register themselves to tasks in FIFO order.
+ * However, this does not guarantee that the tasks will be completed in FIFO order: a long running
+ * task that is not accepting more registration can stay in the queue for an unlimited time until
  * completion.
  */
 #ifndef __SINGLE_THREADED__
@@ -58,23 +62,37 @@ public:
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
 
 private:
+    struct TaskQueue {
+        std::mutex mtx;
+        std::deque<std::shared_ptr<ScheduledTask>> tasks;
+    };
+
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
-    void runWorkerThread();
+    void runWorkerThread(uint64_t workerIdx);
 
     std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
 
     void removeErroringTask(uint64_t scheduledTaskID);
 
-    std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    // Registers the worker to a task from its own queue, or steals one from other queues.
+    std::shared_ptr<ScheduledTask> getTaskAndRegister(uint64_t workerIdx);
     static void runTask(Task* task);
 
+    TaskQueue& getQueue(uint64_t scheduledTaskID) const {
+        return *taskQueues[scheduledTaskID % taskQueues.size()];
+    }
+
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
+    std::vector<std::unique_ptr<TaskQueue>> taskQueues;
     bool stopWorkerThreads;
     std::vector<std::thread> workerThreads;
+    // Used by idle workers to wait for new tasks.
     std::mutex taskSchedulerMtx;
     std::condition_variable cv;
-    uint64_t nextScheduledTaskID;
+    // Incremented whenever a task is scheduled, so idle workers can tell whether a task was
+    // scheduled after they last looked for one.
+    std::atomic<uint64_t> numScheduledTasks;
+    std::atomic<uint64_t> nextScheduledTaskID;
 #if defined(__APPLE__)
     uint32_t threadQos; // Thread quality of service for worker threads.
 #endif
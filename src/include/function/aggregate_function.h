@@ -142,5 +142,11 @@ struct CollectFunction {
     static function_set getFunctionSet();
 };
 
+struct ApproxCountDistinctFunction {
+    static constexpr const char* name = "APPROX_COUNT_DISTINCT";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
@@ -67,8 +67,11 @@ struct KUZU_API Function {
     bool isVarLength = false;
     bool isListLambda = false;
     bool isReadOnly = true;
+    // Volatile functions can return a different result every time they are evaluated, e.g.
+    // random or time-dependent functions. The binder never folds them into literals.
+    bool isVolatile = false;
 
-    Function() : isVarLength{false}, isListLambda{false}, isReadOnly{true} {};
+    Function() : isVarLength{false}, isListLambda{false}, isReadOnly{true}, isVolatile{false} {};
     Function(std::string name, std::vector<common::LogicalTypeID> parameterTypeIDs)
         : name{std::move(name)}, parameterTypeIDs{std::move(parameterTypeIDs)}, isVarLength{false},
           isListLambda{false} {}
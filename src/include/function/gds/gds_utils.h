@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/enums/extend_direction.h"
 #include "gds_state.h"
@@ -22,6 +24,12 @@ public:
         GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
         uint64_t maxIteration, common::NodeOffsetMaskMap* outputNodeMask,
         const std::vector<std::string>& propertiesToScan);
+    // Returns the length of a shortest path from source to destination within maxLength, if any.
+    // The search alternately expands the smaller frontier from the source and the destination
+    // until they meet, so it only suits a single (source, destination) pair.
+    static std::optional<uint16_t> runBidirectionalShortestPath(
+        processor::ExecutionContext* context, graph::Graph* graph, common::nodeID_t sourceNodeID,
+        common::nodeID_t dstNodeID, common::ExtendDirection extendDirection, uint16_t maxLength);
 
     // Run vertex compute without property scan
     static void runVertexCompute(processor::ExecutionContext* context, GDSDensityState densityState,
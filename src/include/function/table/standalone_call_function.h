@@ -29,5 +29,17 @@ struct DropProjectedGraphFunction {
     static function_set getFunctionSet();
 };
 
+struct CreateBTreeIndexFunction {
+    static constexpr const char* name = "CREATE_BTREE_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropBTreeIndexFunction {
+    static constexpr const char* name = "DROP_BTREE_INDEX";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace kuzu
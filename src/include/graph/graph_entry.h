@@ -7,6 +7,8 @@
 namespace kuzu {
 namespace graph {
 
+class CSRGraphCache;
+
 struct NativeGraphEntryTableInfo {
     catalog::TableCatalogEntry* entry;
 
@@ -25,6 +27,8 @@ struct NativeGraphEntryTableInfo {
 struct KUZU_API NativeGraphEntry {
     std::vector<NativeGraphEntryTableInfo> nodeInfos;
     std::vector<NativeGraphEntryTableInfo> relInfos;
+    // Cache of the in-memory CSR of the projected graph the entry is bound from, if any.
+    std::shared_ptr<CSRGraphCache> csrCache;
 
     NativeGraphEntry() = default;
     NativeGraphEntry(std::vector<catalog::TableCatalogEntry*> nodeEntries,
@@ -42,7 +46,7 @@ struct KUZU_API NativeGraphEntry {
 
 private:
     NativeGraphEntry(const NativeGraphEntry& other)
-        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos} {}
+        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos}, csrCache{other.csrCache} {}
 };
 
 } // namespace graph
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+
+#include "common/enums/rel_direction.h"
+#include "graph.h"
+#include "on_disk_graph.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+namespace kuzu {
+namespace processor {
+struct ExecutionContext;
+}
+
+namespace graph {
+
+// Adjacency lists of a rel table in one direction, stored in CSR format and indexed by the offsets
+// of the bound node table.
+struct CSRAdjacency {
+    common::offset_t numNodes = 0;
+    // numNodes + 1 offsets into nbrs.
+    std::unique_ptr<storage::MemoryBuffer> csrOffsets;
+    std::unique_ptr<storage::MemoryBuffer> nbrs;
+
+    std::span<const common::nodeID_t> getNbrs(common::offset_t nodeOffset) const;
+};
+
+// Read-only in-memory copy of the adjacency lists of a projected graph, taken with the rel
+// predicates of the graph applied. A snapshot is valid for transactions starting at the same
+// timestamp as the transaction it was built in, i.e. as long as no write transaction committed.
+class CSRGraphSnapshot {
+public:
+    explicit CSRGraphSnapshot(common::transaction_t startTS) : startTS{startTS} {}
+    DELETE_COPY_AND_MOVE(CSRGraphSnapshot);
+
+    common::transaction_t getStartTS() const { return startTS; }
+
+    const CSRAdjacency* getAdjacency(common::oid_t relTableID,
+        common::RelDataDirection direction) const;
+
+    // Scans all rel tables of the graph in every stored direction, in parallel over the nodes of
+    // their bound tables.
+    static std::shared_ptr<const CSRGraphSnapshot> build(OnDiskGraph& graph,
+        processor::ExecutionContext* context);
+
+private:
+    common::transaction_t startTS;
+    std::map<std::pair<common::oid_t, common::RelDataDirection>, CSRAdjacency> adjacencies;
+};
+
+// Cache of the CSR snapshot of a projected graph, shared by all statements running algorithms on
+// the graph. The snapshot is rebuilt on first use after the underlying tables changed.
+class CSRGraphCache {
+public:
+    std::shared_ptr<const CSRGraphSnapshot> getOrBuild(OnDiskGraph& graph,
+        processor::ExecutionContext* context);
+
+private:
+    std::mutex mtx;
+    std::shared_ptr<const CSRGraphSnapshot> snapshot;
+};
+
+class InMemCSRNbrScanState final : public NbrScanState {
+public:
+    InMemCSRNbrScanState(const CSRAdjacency* fwdAdjacency, const CSRAdjacency* bwdAdjacency,
+        common::SemiMask* nbrNodeMask);
+
+    Chunk getChunk() override { return createChunk(currentNbrs, selVector, {}); }
+    bool next() override;
+
+    void startScan(common::RelDataDirection direction, common::offset_t nodeOffset);
+
+private:
+    const CSRAdjacency* fwdAdjacency;
+    const CSRAdjacency* bwdAdjacency;
+    common::SemiMask* nbrNodeMask;
+    common::SelectionVector selVector;
+    // Neighbours of the node being scanned that are not returned yet.
+    std::span<const common::nodeID_t> remainingNbrs;
+    std::span<const common::nodeID_t> currentNbrs;
+};
+
+// Graph answering neighbour scans from a CSR snapshot. Scans of rel properties and vertex scans are
+// delegated to the on-disk graph.
+class KUZU_API InMemCSRGraph final : public Graph {
+public:
+    InMemCSRGraph(std::unique_ptr<OnDiskGraph> onDiskGraph,
+        std::shared_ptr<const CSRGraphSnapshot> snapshot)
+        : onDiskGraph{std::move(onDiskGraph)}, snapshot{std::move(snapshot)} {}
+
+    NativeGraphEntry* getGraphEntry() override { return onDiskGraph->getGraphEntry(); }
+
+    void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap);
+
+    std::vector<common::table_id_t> getNodeTableIDs() const override {
+        return onDiskGraph->getNodeTableIDs();
+    }
+
+    common::table_id_map_t<common::offset_t> getMaxOffsetMap(
+        transaction::Transaction* transaction) const override {
+        return onDiskGraph->getMaxOffsetMap(transaction);
+    }
+
+    common::offset_t getMaxOffset(transaction::Transaction* transaction,
+        common::table_id_t id) const override {
+        return onDiskGraph->getMaxOffset(transaction, id);
+    }
+
+    common::offset_t getNumNodes(transaction::Transaction* transaction) const override {
+        return onDiskGraph->getNumNodes(transaction);
+    }
+
+    std::vector<GraphRelInfo> getRelInfos(common::table_id_t srcTableID) override {
+        return onDiskGraph->getRelInfos(srcTableID);
+    }
+
+    std::unique_ptr<NbrScanState> prepareRelScan(const catalog::TableCatalogEntry& entry,
+        common::oid_t relTableID, common::table_id_t nbrTableID,
+        std::vector<std::string> relProperties) override;
+
+    EdgeIterator scanFwd(common::nodeID_t nodeID, NbrScanState& state) override;
+    EdgeIterator scanBwd(common::nodeID_t nodeID, NbrScanState& state) override;
+
+    std::unique_ptr<VertexScanState> prepareVertexScan(catalog::TableCatalogEntry* tableEntry,
+        const std::vector<std::string>& propertiesToScan) override {
+        return onDiskGraph->prepareVertexScan(tableEntry, propertiesToScan);
+    }
+    VertexIterator scanVertices(common::offset_t beginOffset, common::offset_t endOffsetExclusive,
+        VertexScanState& state) override {
+        return onDiskGraph->scanVertices(beginOffset, endOffsetExclusive, state);
+    }
+
+private:
+    std::unique_ptr<OnDiskGraph> onDiskGraph;
+    std::shared_ptr<const CSRGraphSnapshot> snapshot;
+    common::NodeOffsetMaskMap* nodeOffsetMaskMap = nullptr;
+};
+
+} // namespace graph
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -9,6 +10,8 @@
 namespace kuzu {
 namespace graph {
 
+class CSRGraphCache;
+
 enum class GraphEntryType : uint8_t {
     NATIVE = 0,
     CYPHER = 1,
@@ -41,6 +44,8 @@ struct ParsedNativeGraphTableInfo {
 struct KUZU_API ParsedNativeGraphEntry : ParsedGraphEntry {
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    // Set if the graph is projected with caching enabled.
+    std::shared_ptr<CSRGraphCache> csrCache;
 
     ParsedNativeGraphEntry(std::vector<ParsedNativeGraphTableInfo> nodeInfos,
         std::vector<ParsedNativeGraphTableInfo> relInfos)
@@ -23,6 +23,7 @@ struct ClientConfigDefault {
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
     static constexpr bool ENABLE_PLAN_OPTIMIZER = true;
     static constexpr bool ENABLE_INTERNAL_CATALOG = false;
+    static constexpr bool ENABLE_STREAMING_RESULTS = false;
 };
 
 struct ClientConfig {
@@ -57,6 +58,8 @@ struct ClientConfig {
     bool enablePlanOptimizer = ClientConfigDefault::ENABLE_PLAN_OPTIMIZER;
     // If use internal catalog during binding
     bool enableInternalCatalog = ClientConfigDefault::ENABLE_INTERNAL_CATALOG;
+    // If stream the results of read-only queries instead of materializing them
+    bool enableStreamingResults = ClientConfigDefault::ENABLE_STREAMING_RESULTS;
 };
 
 } // namespace main
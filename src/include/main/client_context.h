@@ -53,6 +53,7 @@ class AttachedKuzuDatabase;
 struct SpillToDiskSetting;
 struct ExtensionOption;
 class EmbeddedShell;
+class QueryResultStream;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -75,6 +76,7 @@ class KUZU_API ClientContext {
     friend class parser::StandaloneCallRewriter;
     friend struct SpillToDiskSetting;
     friend class EmbeddedShell;
+    friend class QueryResultStream;
     friend class extension::ExtensionManager;
 
 public:
@@ -227,6 +229,26 @@ private:
     std::unique_ptr<QueryResult> queryNoLock(std::string_view query,
         std::optional<uint64_t> queryID = std::nullopt);
 
+    // Whether plans can be shared with other connections through the plan cache.
+    bool canUsePlanCacheNoLock() const;
+    // Returns the key of the query in the plan cache. Plans of prepared statements are cached apart
+    // from plans of executed statements, as only the latter have been mapped to physical plans.
+    std::string getPlanCacheKey(std::string_view normalizedQuery, bool isPrepare,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters) const;
+    // Returns an empty result if the key isn't cached. The plan is prepared with the given values.
+    PrepareResult lookUpPlanCacheNoLock(const std::string& key,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters);
+    void addToPlanCacheNoLock(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedPreparedStatement) const;
+
+    bool canStreamResult(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedPreparedStatement) const;
+    std::unique_ptr<QueryResult> executeAndStreamNoLock(PreparedStatement* preparedStatement,
+        CachedPreparedStatement* cachedPreparedStatement, uint64_t queryID);
+    // Materializes the rest of the streamed result, if any, so that the transaction context can be
+    // used by another statement.
+    void finishActiveStreamNoLock();
+
     bool canExecuteWriteQuery() const;
 
     std::unique_ptr<QueryResult> handleFailedExecution(std::optional<uint64_t> queryID,
@@ -262,6 +284,8 @@ private:
     // Whether the transaction should be rolled back on destruction. If the parent database is
     // closed, the rollback should be prevented or it will SEGFAULT.
     bool preventTransactionRollbackOnDestruction = false;
+    // Result being streamed in the auto transaction of this context.
+    QueryResultStream* activeStream = nullptr;
 };
 
 } // namespace main
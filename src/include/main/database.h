@@ -42,6 +42,7 @@ class StorageExtension;
 namespace main {
 struct ExtensionOption;
 class DatabaseManager;
+class PlanCache;
 
 /**
  * @brief Stores runtime configuration for creating or opening a Database
@@ -154,6 +155,8 @@ public:
 
     uint64_t getNextQueryID();
 
+    PlanCache* getPlanCache() const { return planCache.get(); }
+
 private:
     using construct_bm_func_t =
         std::function<std::unique_ptr<storage::BufferManager>(const Database&)>;
@@ -185,6 +188,7 @@ private:
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<DatabaseManager> databaseManager;
     std::unique_ptr<extension::ExtensionManager> extensionManager;
+    std::unique_ptr<PlanCache> planCache;
     QueryIDGenerator queryIDGenerator;
     std::shared_ptr<common::DatabaseLifeCycleManager> dbLifeCycleManager;
     std::vector<std::unique_ptr<extension::TransformerExtension>> transformerExtensions;
@@ -61,10 +61,13 @@ struct DBConfig {
     bool readOnly;
     uint64_t maxDBSize;
     bool enableMultiWrites;
+    uint64_t groupCommitDelayInMicros;
     bool autoCheckpoint;
     uint64_t checkpointThreshold;
     bool forceCheckpointOnClose;
     bool enableSpillingToDisk;
+    // Maximum number of plans in the database-wide plan cache. 0 disables the cache.
+    uint64_t planCacheSize;
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
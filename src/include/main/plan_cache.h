@@ -0,0 +1,83 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/enums/statement_type.h"
+#include "planner/operator/logical_plan.h"
+
+namespace kuzu {
+namespace common {
+class Value;
+}
+namespace binder {
+class Expression;
+}
+namespace parser {
+class Statement;
+}
+
+namespace main {
+
+// Optimized plan of a statement shared by all connections of a database. A cached plan must never
+// be modified, and connections map it to a physical plan of their own for each execution.
+struct CachedPlan {
+    std::shared_ptr<parser::Statement> parsedStatement;
+    common::StatementType statementType;
+    bool readOnly;
+    // Parameters the plan was bound with. Connections copy the values before binding new ones.
+    std::unordered_map<std::string, std::shared_ptr<common::Value>> parameterMap;
+    // Parameters whose values are folded into the plan. Other parameter values are only read when
+    // the plan is mapped, so the plan is reused for any values of them.
+    std::unordered_set<std::string> foldedParameters;
+    planner::LogicalPlan logicalPlan;
+    std::vector<std::shared_ptr<binder::Expression>> columns;
+    // Version of the catalog the plan was bound against.
+    uint64_t catalogVersion;
+
+    bool hasFoldedValues(
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters) const;
+};
+
+// Database-wide cache of optimized plans keyed by normalized query text, parameter types and the
+// client settings affecting planning. Entries bound against an older catalog version are dropped on
+// lookup, and the whole cache is cleared when checkpointing resets the catalog version. The least
+// recently used entry is evicted once the cache holds more plans than its capacity.
+class PlanCache {
+public:
+    // Collapses whitespace outside string literals and escaped names, and strips the trailing
+    // semicolon, so that queries differing only in formatting share a cache entry.
+    static std::string normalizeQuery(std::string_view query);
+
+    // Returns nullptr if the key isn't cached, or if the cached plan is stale or has other values
+    // of the parameters folded into it.
+    std::shared_ptr<const CachedPlan> lookUp(const std::string& key, uint64_t catalogVersion,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters);
+    void insert(const std::string& key, std::shared_ptr<const CachedPlan> plan, uint64_t capacity);
+    void clear();
+
+    uint64_t getNumEntries();
+    uint64_t getNumHits();
+    uint64_t getNumMisses();
+
+private:
+    struct Entry {
+        std::shared_ptr<const CachedPlan> plan;
+        std::list<std::string>::iterator lruPos;
+    };
+
+    std::mutex mtx;
+    std::unordered_map<std::string, Entry> entries;
+    // Keys ordered from the most to the least recently used.
+    std::list<std::string> lruList;
+    uint64_t numHits = 0;
+    uint64_t numMisses = 0;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "common/api.h"
@@ -24,6 +25,14 @@ struct CachedPreparedStatement {
     std::shared_ptr<parser::Statement> parsedStatement;
     std::unique_ptr<planner::LogicalPlan> logicalPlan;
     std::vector<std::shared_ptr<binder::Expression>> columns;
+    // Normalized text of the query, used to look up its plan when executing it with parameters.
+    std::string normalizedQuery;
+    // Key to cache the plan under, or empty if the plan shouldn't be cached.
+    std::string planCacheKey;
+    // Version of the catalog the statement was bound against.
+    uint64_t catalogVersion = 0;
+    // Parameters whose values are folded into the plan while binding and planning.
+    std::unordered_set<std::string> foldedParameters;
 
     CachedPreparedStatement();
     ~CachedPreparedStatement();
@@ -10,14 +10,21 @@
 #include "processor/result/flat_tuple.h"
 #include "query_summary.h"
 namespace kuzu {
+namespace common {
+class ArrowRowBatch;
+} // namespace common
+
 namespace main {
 
+class QueryResultStream;
+
 /**
  * @brief QueryResult stores the result of a query execution.
  */
 class QueryResult {
     friend class Connection;
     friend class ClientContext;
+    friend class common::ArrowRowBatch;
     class QueryResultIterator {
     private:
         QueryResult* currentResult;
@@ -72,7 +79,8 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. For a streamed result, this fetches all remaining
+     * tuples.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -107,7 +115,8 @@ public:
     KUZU_API std::string toString() const;
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. A streamed result can't be reset once tuples have
+     * been consumed from it.
      */
     KUZU_API void resetIterator();
 
@@ -158,6 +167,8 @@ private:
     std::shared_ptr<processor::FactorizedTable> factorizedTable;
     std::unique_ptr<processor::FlatTupleIterator> iterator;
     std::shared_ptr<processor::FlatTuple> tuple;
+    // Set if the result is streamed instead of fully materialized in factorizedTable.
+    std::unique_ptr<QueryResultStream> stream;
 
     // execution statistics
     std::unique_ptr<QuerySummary> querySummary;
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+
+#include "common/profiler.h"
+#include "processor/execution_context.h"
+#include "processor/physical_plan.h"
+#include "processor/result/result_set.h"
+
+namespace kuzu {
+namespace processor {
+class ResultCollector;
+}
+
+namespace main {
+
+class ClientContext;
+
+/**
+ * @brief QueryResultStream produces the result of a read-only query in batches as the client pulls
+ * them, instead of materializing the whole result at once. The pipelines the root pipeline depends
+ * on (e.g. hash join builds) are executed upfront, and the root pipeline is executed on the
+ * client's thread one batch at a time, so execution pauses while the client isn't pulling. The auto
+ * transaction of the query stays open until the stream is finished.
+ */
+class QueryResultStream {
+public:
+    // Number of tuples the result table holds at most (plus one chunk) at any time.
+    static constexpr uint64_t BATCH_SIZE = 2048;
+
+    QueryResultStream(ClientContext* context, std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<processor::ExecutionContext> executionContext,
+        std::unique_ptr<processor::PhysicalPlan> physicalPlan);
+
+    // Initializes the root pipeline and fetches the first batch. Must be called after the
+    // dependencies of the root pipeline are executed.
+    void initNoLock();
+
+    bool isFinished() const { return finished; }
+    // Number of tuples fetched into the result table and then cleared from it.
+    uint64_t getNumDiscardedTuples() const { return numDiscardedTuples; }
+
+    // Replaces the tuples in the result table with the next batch.
+    void fetchNextBatch();
+    // Appends all remaining tuples to the result table and finishes the stream.
+    void fetchRemaining();
+    void fetchRemainingNoLock();
+    // Finishes the stream without fetching the remaining tuples.
+    void finish();
+    void finishNoLock(bool commit);
+
+private:
+    void fetchNextBatchNoLock();
+    // Returns false once the root pipeline is exhausted.
+    bool fetchNoLock(uint64_t numTuples);
+
+private:
+    ClientContext* context;
+    std::unique_ptr<common::Profiler> profiler;
+    std::unique_ptr<processor::ExecutionContext> executionContext;
+    std::unique_ptr<processor::PhysicalPlan> physicalPlan;
+    std::unique_ptr<processor::ResultSet> resultSet;
+    processor::ResultCollector* resultCollector;
+    uint64_t numDiscardedTuples;
+    bool finished;
+};
+
+} // namespace main
+} // namespace kuzu
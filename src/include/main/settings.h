@@ -184,6 +184,24 @@ struct EnableMVCCSetting {
     }
 };
 
+struct GroupCommitDelaySetting {
+    static constexpr auto name = "group_commit_delay";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->groupCommitDelayInMicros);
+    }
+};
+
+struct PlanCacheSizeSetting {
+    static constexpr auto name = "plan_cache_size";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getDBConfig()->planCacheSize);
+    }
+};
+
 struct CheckpointThresholdSetting {
     static constexpr auto name = "checkpoint_threshold";
     static constexpr auto inputType = common::LogicalTypeID::INT64;
@@ -253,5 +271,17 @@ struct EnableInternalCatalogSetting {
     }
 };
 
+struct EnableStreamingResultsSetting {
+    static constexpr auto name = "enable_streaming_results";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableStreamingResults = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value::createValue(context->getClientConfig()->enableStreamingResults);
+    }
+};
+
 } // namespace main
 } // namespace kuzu
@@ -10,6 +10,7 @@ namespace planner {
 enum class LogicalScanNodeTableType : uint8_t {
     SCAN = 0,
     PRIMARY_KEY_SCAN = 1,
+    INDEX_SCAN = 2,
 };
 
 struct ExtraScanNodeTableInfo {
@@ -32,6 +33,28 @@ struct PrimaryKeyScanInfo final : ExtraScanNodeTableInfo {
     }
 };
 
+// Range lookup on a secondary index. A null bound means the range is unbounded on that side.
+struct IndexScanInfo final : ExtraScanNodeTableInfo {
+    std::string indexName;
+    std::shared_ptr<binder::Expression> property;
+    std::shared_ptr<binder::Expression> lowerBound;
+    bool lowerInclusive;
+    std::shared_ptr<binder::Expression> upperBound;
+    bool upperInclusive;
+
+    IndexScanInfo(std::string indexName, std::shared_ptr<binder::Expression> property,
+        std::shared_ptr<binder::Expression> lowerBound, bool lowerInclusive,
+        std::shared_ptr<binder::Expression> upperBound, bool upperInclusive)
+        : indexName{std::move(indexName)}, property{std::move(property)},
+          lowerBound{std::move(lowerBound)}, lowerInclusive{lowerInclusive},
+          upperBound{std::move(upperBound)}, upperInclusive{upperInclusive} {}
+
+    std::unique_ptr<ExtraScanNodeTableInfo> copy() const override {
+        return std::make_unique<IndexScanInfo>(indexName, property, lowerBound, lowerInclusive,
+            upperBound, upperInclusive);
+    }
+};
+
 struct LogicalScanNodeTablePrintInfo final : OPPrintInfo {
     std::shared_ptr<binder::Expression> nodeID;
     binder::expression_vector properties;
@@ -9,6 +9,9 @@ namespace kuzu {
 namespace planner {
 
 const uint64_t MAX_LEVEL_TO_PLAN_EXACTLY = 7;
+// Planning budget of the exact dp. Once the number of plans enumerated for a query graph exceeds
+// the budget, the remaining levels are planned approximately.
+const uint64_t MAX_NUM_PLANS_TO_ENUMERATE_EXACTLY = 20000;
 
 // Different from vanilla dp algorithm where one optimal plan is kept per subgraph, we keep multiple
 // plans each with a different factorization structure. The following example will explain our
@@ -26,6 +29,7 @@ public:
     explicit SubgraphPlans(const binder::SubqueryGraph& subqueryGraph);
 
     uint64_t getMaxCost() const { return maxCost; }
+    uint64_t getMinCost() const;
 
     void addPlan(LogicalPlan plan);
 
@@ -48,7 +52,8 @@ private:
 };
 
 // A DPLevel is a collection of plans per subgraph. All subgraph should have the same number of
-// variables.
+// variables. When the level is full, the subgraph with the most expensive best plan is evicted in
+// favour of a cheaper one, so approximate levels keep the most promising subgraphs.
 class DPLevel {
 public:
     bool contains(const binder::SubqueryGraph& subqueryGraph) const {
@@ -65,6 +70,10 @@ public:
 
     void clear() { subgraph2Plans.clear(); }
 
+private:
+    // Returns false if the level is full and all subgraphs have cheaper plans.
+    bool tryEvictSubgraph(uint64_t cost);
+
 private:
     constexpr static uint32_t MAX_NUM_SUBGRAPH = 50;
 
@@ -87,6 +96,8 @@ public:
 
     void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan);
 
+    uint64_t getNumEnumeratedPlans() const { return numEnumeratedPlans; }
+
     void clear();
 
 private:
@@ -99,6 +110,7 @@ private:
 
 private:
     std::vector<DPLevel> dpLevels;
+    uint64_t numEnumeratedPlans = 0;
 };
 
 } // namespace planner
@@ -13,6 +13,9 @@ namespace kuzu {
 namespace main {
 class ClientContext;
 }
+namespace storage {
+class Spiller;
+}
 namespace processor {
 class AggregateHashTable;
 
@@ -66,8 +69,12 @@ protected:
 
         void appendTuple(std::span<uint8_t> tuple);
 
+        // Spilled blocks are loaded back one at a time while merging.
         void mergeInto(AggregateHashTable& hashTable);
 
+        uint64_t getNumBytesSpilled() const { return numBytesSpilled; }
+        uint64_t getNumBytesRead() const { return numBytesRead; }
+
         bool empty() const {
             auto headBlock = this->headBlock.load();
             return (headBlock == nullptr || headBlock->numTuplesReserved == 0) &&
@@ -100,8 +107,22 @@ protected:
         // numTuplesWritten)
         std::atomic<TupleBlock*> headBlock;
         uint64_t numTuplesPerBlock;
+
+    private:
+        // Once the buffer pool is under pressure, fully written blocks are spilled to disk
+        // until they get merged into the hash table.
+        void spillIfNecessary(TupleBlock& block);
+
+    private:
+        // Null if spilling to disk is disabled.
+        storage::Spiller* spiller;
+        std::atomic<uint64_t> numBytesSpilled;
+        std::atomic<uint64_t> numBytesRead;
     };
 
+    // The fraction of the buffer pool in use above which queued tuple blocks get spilled.
+    static constexpr double SPILL_MEMORY_RATIO = 0.5;
+
 protected:
     std::mutex mtx;
     std::atomic<uint64_t> currentOffset;
@@ -80,6 +80,10 @@ public:
 
     uint64_t getNumTuples() const;
 
+    // Bytes of queued tuples spilled to disk and read back while finalizing the partitions.
+    uint64_t getNumBytesSpilled() const;
+    uint64_t getNumBytesRead() const;
+
     uint64_t getCurrentOffset() const { return currentOffset; }
 
     void setLimitNumber(uint64_t num) { limitNumber = num; }
@@ -160,6 +164,9 @@ public:
 
     void executeInternal(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return make_unique<HashAggregate>(sharedState, copyVector(aggregateFunctions),
             copyVector(aggInfos), children[0]->copy(), id, printInfo->copy());
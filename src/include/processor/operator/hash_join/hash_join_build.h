@@ -38,18 +38,86 @@ class HashJoinBuild;
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
+//
+// If spilling is enabled and the build side grows beyond the memory budget, the state switches to
+// a hybrid (grace) hash join: tuples are radix-partitioned by their hash, and the largest
+// partitions are spilled to disk until the resident ones fit into the budget. The resident
+// partitions are merged back into the global hash table at finalization. Probe tuples falling into
+// a spilled partition are buffered by each HashJoinProbe thread and joined with that partition
+// after the probe side is exhausted, one partition at a time.
 class HashJoinSharedState {
 public:
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 6;
+    static constexpr uint64_t NUM_PARTITIONS = 1 << NUM_PARTITIONS_LOG2;
+    // The fraction of the buffer pool the build side may use before partitions are spilled.
+    static constexpr double SPILL_MEMORY_RATIO = 0.5;
+    // Number of tuple blocks a build thread accumulates locally before merging them into the
+    // shared state when spilling is enabled.
+    static constexpr uint64_t NUM_LOCAL_BLOCKS_TO_MERGE = 64;
+
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
         : hashTable{std::move(hashTable)} {};
+    ~HashJoinSharedState();
+    DELETE_COPY_AND_MOVE(HashJoinSharedState);
 
     void mergeLocalHashTable(JoinHashTable& localHashTable);
 
     JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    void enableSpilling(storage::Spiller* spiller, uint64_t memoryBudget) {
+        this->spiller = spiller;
+        this->memoryBudget = memoryBudget;
+    }
+    bool isSpillingEnabled() const { return spiller != nullptr; }
+    storage::Spiller* getSpiller() const { return spiller; }
+
+    // Spills the remaining tuples of spilled partitions and merges the resident partitions into
+    // the global hash table. Must be called before building the hash slots.
+    void finalizePartitions();
+    bool hasSpilledPartitions() const { return numSpilledPartitions > 0; }
+    uint64_t getNumBytesSpilled() const { return numBytesSpilled; }
+    common::idx_t getPartitionIdx(common::hash_t hash) const {
+        return hash >> SHIFT_FOR_PARTITIONING;
+    }
+    bool isPartitionSpilled(common::idx_t partitionIdx) const {
+        return !partitions.empty() && partitions[partitionIdx]->spilled;
+    }
+    // Loads a spilled partition so that it can be probed. Partitions are shared between probe
+    // threads and released from memory once the last thread is done with them.
+    JoinHashTable* acquireSpilledPartition(common::idx_t partitionIdx);
+    void releaseSpilledPartition(common::idx_t partitionIdx);
+
+private:
+    std::vector<JoinHashTable*> getPartitionTables() const;
+    void partitionGlobalHashTable();
+    void spillPartitionsIfNecessary();
+
+private:
+    static constexpr uint8_t SHIFT_FOR_PARTITIONING =
+        sizeof(common::hash_t) * 8 - NUM_PARTITIONS_LOG2;
+
+    struct Partition {
+        explicit Partition(std::unique_ptr<JoinHashTable> hashTable)
+            : hashTable{std::move(hashTable)} {}
+
+        std::unique_ptr<JoinHashTable> hashTable;
+        bool spilled = false;
+        std::mutex mtx;
+        // Number of probe threads currently using the loaded partition.
+        uint64_t numProbers = 0;
+    };
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+
+private:
+    storage::Spiller* spiller = nullptr;
+    uint64_t memoryBudget = UINT64_MAX;
+    // Empty until the build side exceeds the memory budget for the first time.
+    std::vector<std::unique_ptr<Partition>> partitions;
+    uint64_t numSpilledPartitions = 0;
+    uint64_t numBytesSpilled = 0;
 };
 
 struct HashJoinBuildInfo {
@@ -89,6 +157,9 @@ public:
 
     void finalizeInternal(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return make_unique<HashJoinBuild>(operatorType, sharedState, info.copy(),
             children[0]->copy(), id, printInfo->copy());
@@ -35,6 +35,8 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        probeSideDataPos = other.probeSideDataPos;
+        probeSideTableSchema = other.probeSideTableSchema.copy();
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -43,6 +45,27 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // Vectors produced by the probe side, which are buffered for spilled build side partitions.
+    // Only set if the build side may spill.
+    std::vector<DataPos> probeSideDataPos;
+    FactorizedTableSchema probeSideTableSchema;
+};
+
+// Probe tuples whose keys fall into a spilled build side partition are buffered per partition and
+// joined with the partition once the probe side has been exhausted.
+struct SpilledProbeState {
+    storage::MemoryManager* memoryManager = nullptr;
+    // Buffered probe tuples for each spilled partition. The last column holds the multiplicity of
+    // the result set.
+    std::vector<std::unique_ptr<FactorizedTable>> partitions;
+    std::vector<common::ValueVector*> vectors;
+    std::unique_ptr<common::ValueVector> multiplicityVector;
+    std::vector<ft_col_idx_t> colIdxes;
+    std::vector<common::DataChunkState*> states;
+    bool probeSideExhausted = false;
+    // The partition whose buffered tuples are being joined.
+    common::idx_t partitionIdx = common::INVALID_IDX;
+    ft_tuple_idx_t nextTupleIdx = 0;
 };
 
 struct HashJoinProbePrintInfo final : OPPrintInfo {
@@ -89,6 +112,12 @@ private:
                            getMatchedTuplesForUnFlatKey(context);
     }
     bool getMatchedTuplesForFlatKey(ExecutionContext* context);
+    // Returns the next probe tuple to join with the current hash table, which is either pulled
+    // from the probe side or a buffered tuple of a spilled partition.
+    bool getNextProbeTuple(ExecutionContext* context);
+    common::idx_t getSpilledPartitionIdx();
+    void bufferProbeTuple(common::idx_t partitionIdx);
+    bool scanBufferedProbeTuple();
     // We can probe a batch of input tuples if we know they have at most one match.
     bool getMatchedTuplesForUnFlatKey(ExecutionContext* context);
 
@@ -106,6 +135,9 @@ private:
     std::shared_ptr<HashJoinSharedState> sharedState;
     common::JoinType joinType;
     bool flatProbe;
+    // Either the global hash table or the spilled partition currently being joined.
+    JoinHashTable* hashTable = nullptr;
+    std::unique_ptr<SpilledProbeState> spilledProbeState;
 
     ProbeDataInfo probeDataInfo;
     std::vector<common::ValueVector*> vectorsToReadInto;
@@ -6,7 +6,8 @@
 namespace kuzu {
 namespace storage {
 class MemoryManager;
-}
+class Spiller;
+} // namespace storage
 namespace processor {
 
 class JoinHashTable : public BaseHashTable {
@@ -26,6 +27,11 @@ public:
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
 
+    // Computes the hashes of the given (non-null) keys into hashVector. The tmpHashResultVector may
+    // be null if there is only one keyVector.
+    void computeProbeHashes(const std::vector<common::ValueVector*>& keyVectors,
+        common::ValueVector& hashVector, common::SelectionVector& hashSelVec,
+        common::ValueVector* tmpHashResultVector) const;
     // The tmpHashResultVector may be null if there is only one keyVector
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
         common::SelectionVector& hashSelVec, common::ValueVector* tmpHashResultVector,
@@ -43,6 +49,33 @@ public:
         factorizedTable->lookup(vectors, colIdxesToScan, tuplesToRead, startPos, numTuplesToRead);
     }
     void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
+    void merge(FactorizedTable& table) { factorizedTable->merge(table); }
+    void clear() { factorizedTable->clear(); }
+
+    // Spills the tuples of this table to disk. The last tuple block is kept in memory if more
+    // tuples may still be appended. Returns the number of bytes spilled.
+    uint64_t spillToDisk(const storage::Spiller& spiller, bool keepLastBlock) {
+        return factorizedTable->spillFlatTupleBlocks(spiller, keepLastBlock);
+    }
+    // Loads the spilled tuples back into memory and builds the hash slots over them, so that the
+    // table can be probed.
+    void loadFromDisk(const storage::Spiller& spiller);
+    // Releases the memory of a table loaded by loadFromDisk.
+    void unloadToDisk(const storage::Spiller& spiller);
+    uint64_t getResidentMemoryUsage() const {
+        return factorizedTable->getNumResidentFlatTupleBlocks() * common::TEMP_PAGE_SIZE;
+    }
+
+    // Creates an empty hash table with the same key types and schema as this one.
+    std::unique_ptr<JoinHashTable> createEmptyTable() const {
+        return std::make_unique<JoinHashTable>(*memoryManager, common::LogicalType::copy(keyTypes),
+            getTableSchema()->copy());
+    }
+    // Moves the tuples of this table into the given tables based on the hash bits above
+    // shiftForPartitioning. Overflow data is moved into the first table, which has to outlive the
+    // others. The table is empty afterwards.
+    void partitionInto(const std::vector<JoinHashTable*>& partitions,
+        uint8_t shiftForPartitioning);
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
@@ -28,6 +28,9 @@ private:
 
 class Intersect : public PhysicalOperator {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::INTERSECT;
+    // Right lists larger than the left one by more than this factor are galloped through instead
+    // of being merged.
+    static constexpr uint64_t GALLOPING_THRESHOLD = 32;
 
 public:
     Intersect(const DataPos& outputDataPos, std::vector<IntersectDataInfo> intersectDataInfos,
@@ -55,6 +55,12 @@ public:
     uint8_t* getBlockEndTuplePtr(uint32_t blockIdx, uint64_t endTupleIdx,
         uint32_t endTupleBlockIdx) const;
 
+    // Sorted runs waiting in the queue can be moved to disk while the buffer pool is under
+    // pressure. They have to be loaded again before being merged.
+    // Returns the number of bytes spilled.
+    uint64_t spillToDisk(const storage::Spiller& spiller) const;
+    void loadFromDisk(const storage::Spiller& spiller) const;
+
 private:
     uint32_t numBytesPerTuple;
     uint32_t numTuplesPerBlock;
@@ -172,6 +178,8 @@ struct KeyBlockMergeMorsel {
 // acquire a lock before calling these functions.
 class KeyBlockMergeTaskDispatcher {
 public:
+    ~KeyBlockMergeTaskDispatcher();
+
     inline bool isDoneMerge() {
         std::lock_guard<std::mutex> keyBlockMergeDispatcherLock{mtx};
         // Returns true if there are no more merge task to do or the sortedKeyBlocks is empty
@@ -183,6 +191,11 @@ public:
 
     void doneMorsel(std::unique_ptr<KeyBlockMergeMorsel> morsel);
 
+    uint64_t getNumBytesSpilled() {
+        std::lock_guard<std::mutex> keyBlockMergeDispatcherLock{mtx};
+        return numBytesSpilled;
+    }
+
     // This function is used to initialize the columns of keyBlockMergeTaskDispatcher based on
     // sharedFactorizedTablesAndSortedKeyBlocks.
     void init(storage::MemoryManager* memoryManager,
@@ -191,9 +204,21 @@ public:
         uint64_t numBytesPerTuple);
 
 private:
+    // Spills the given run if the buffer pool is under pressure. Must be called with the lock held.
+    void spillIfNecessary(const MergedKeyBlocks& keyBlocks);
+
+private:
+    // The fraction of the buffer pool in use above which sorted runs waiting to be merged get
+    // spilled.
+    static constexpr double SPILL_MEMORY_RATIO = 0.5;
+
     std::mutex mtx;
 
     storage::MemoryManager* memoryManager = nullptr;
+    // Null if spilling to disk is disabled.
+    storage::Spiller* spiller = nullptr;
+    bool hasSpilled = false;
+    uint64_t numBytesSpilled = 0;
     std::queue<std::shared_ptr<MergedKeyBlocks>>* sortedKeyBlocks = nullptr;
     std::vector<std::shared_ptr<KeyBlockMergeTask>> activeKeyBlockMergeTasks;
     std::unique_ptr<KeyBlockMerger> keyBlockMerger;
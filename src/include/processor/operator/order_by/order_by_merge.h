@@ -24,6 +24,9 @@ public:
 
     void executeInternal(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return std::make_unique<OrderByMerge>(sharedState, sharedDispatcher, id, printInfo->copy());
     }
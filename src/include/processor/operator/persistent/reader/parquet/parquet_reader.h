@@ -9,6 +9,7 @@
 #include "parquet_types.h"
 #include "protocol/TCompactProtocol.h"
 #include "resizable_buffer.h"
+#include "storage/predicate/column_predicate.h"
 
 namespace kuzu {
 namespace processor {
@@ -56,6 +57,11 @@ public:
 
     kuzu_parquet::format::FileMetaData* getMetadata() const { return metadata.get(); }
 
+    // Returns true if the column chunk statistics of the row group show that none of its rows
+    // satisfies the predicates. Predicates are given per top-level column.
+    bool canSkipRowGroup(uint64_t groupIdx,
+        const std::vector<storage::ColumnPredicateSet>& columnPredicates) const;
+
 private:
     std::unique_ptr<kuzu_apache::thrift::protocol::TProtocol> createThriftProtocol(
         common::FileInfo* fileInfo_, bool prefetch_mode) {
@@ -71,6 +77,7 @@ private:
     }
     static common::LogicalType deriveLogicalType(const kuzu_parquet::format::SchemaElement& s_ele);
     void initMetadata();
+    void initColumnStatsInfos();
     std::unique_ptr<ColumnReader> createReader();
     std::unique_ptr<ColumnReader> createReaderRecursive(uint64_t depth, uint64_t maxDefine,
         uint64_t maxRepeat, uint64_t& nextSchemaIdx, uint64_t& nextFileIdx);
@@ -86,6 +93,13 @@ private:
     std::vector<bool> columnSkips;
     std::vector<std::string> columnNames;
     std::vector<common::LogicalType> columnTypes;
+    // Column chunk and type of each top-level column whose statistics can be used to skip row
+    // groups. Nested columns and columns of other types have an invalid chunk index.
+    struct ColumnStatsInfo {
+        common::idx_t chunkIdx;
+        common::LogicalTypeID typeID;
+    };
+    std::vector<ColumnStatsInfo> columnStatsInfos;
 
     std::unique_ptr<kuzu_parquet::format::FileMetaData> metadata;
     main::ClientContext* context;
@@ -93,10 +107,12 @@ private:
 
 struct ParquetScanSharedState final : function::ScanFileWithProgressSharedState {
     explicit ParquetScanSharedState(common::FileScanInfo fileScanInfo, uint64_t numRows,
-        main::ClientContext* context, std::vector<bool> columnSkips);
+        main::ClientContext* context, std::vector<bool> columnSkips,
+        std::vector<storage::ColumnPredicateSet> columnPredicates);
 
     std::vector<std::unique_ptr<ParquetReader>> readers;
     std::vector<bool> columnSkips;
+    std::vector<storage::ColumnPredicateSet> columnPredicates;
     uint64_t totalRowsGroups;
     std::atomic<uint64_t> numBlocksReadByFiles;
 };
@@ -41,6 +41,7 @@ enum class PhysicalOperatorType : uint8_t {
     HASH_JOIN_PROBE,
     IMPORT_DATABASE,
     INDEX_LOOKUP,
+    INDEX_SCAN_NODE_TABLE,
     INSERT,
     INTERSECT_BUILD,
     INTERSECT,
@@ -131,7 +132,7 @@ public:
 
     virtual void finalize(ExecutionContext* context);
 
-    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+    virtual std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
 
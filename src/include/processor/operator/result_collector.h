@@ -81,6 +81,13 @@ public:
         return sharedState->getTable();
     }
 
+    common::AccumulateType getAccumulateType() const { return info.accumulateType; }
+
+    // Pulls tuples from the child into the result table until at least numTuples flat tuples are
+    // appended. Returns false once the child is exhausted. This is used to stream results on the
+    // client thread instead of executing the collector as a pipeline.
+    bool fetchTuples(ExecutionContext* context, uint64_t numTuples);
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return std::make_unique<ResultCollector>(info.copy(), sharedState, children[0]->copy(), id,
             printInfo->copy());
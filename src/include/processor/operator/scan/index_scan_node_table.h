@@ -0,0 +1,90 @@
+#pragma once
+
+#include "expression_evaluator/expression_evaluator.h"
+#include "processor/operator/scan/scan_node_table.h"
+
+namespace kuzu {
+namespace processor {
+
+struct IndexScanPrintInfo final : OPPrintInfo {
+    binder::expression_vector expressions;
+    std::string indexName;
+    std::string range;
+    std::string alias;
+
+    IndexScanPrintInfo(binder::expression_vector expressions, std::string indexName,
+        std::string range, std::string alias)
+        : expressions{std::move(expressions)}, indexName{std::move(indexName)},
+          range{std::move(range)}, alias{std::move(alias)} {}
+
+    std::string toString() const override;
+
+    std::unique_ptr<OPPrintInfo> copy() const override {
+        return std::unique_ptr<IndexScanPrintInfo>(new IndexScanPrintInfo(*this));
+    }
+
+private:
+    IndexScanPrintInfo(const IndexScanPrintInfo& other)
+        : OPPrintInfo{other}, expressions{other.expressions}, indexName{other.indexName},
+          range{other.range}, alias{other.alias} {}
+};
+
+struct IndexScanBound {
+    std::unique_ptr<evaluator::ExpressionEvaluator> evaluator;
+    bool inclusive;
+
+    IndexScanBound() : evaluator{nullptr}, inclusive{true} {}
+    IndexScanBound(std::unique_ptr<evaluator::ExpressionEvaluator> evaluator, bool inclusive)
+        : evaluator{std::move(evaluator)}, inclusive{inclusive} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(IndexScanBound);
+
+private:
+    IndexScanBound(const IndexScanBound& other)
+        : evaluator{other.evaluator == nullptr ? nullptr : other.evaluator->copy()},
+          inclusive{other.inclusive} {}
+};
+
+// Scans the nodes whose indexed property falls into a range through a secondary index. Index
+// entries of updated or deleted rows are only removed at checkpoint, so the predicate has to be
+// re-evaluated on the output.
+class IndexScanNodeTable final : public ScanTable {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::INDEX_SCAN_NODE_TABLE;
+
+public:
+    IndexScanNodeTable(ScanOpInfo opInfo, ScanNodeTableInfo tableInfo, std::string indexName,
+        IndexScanBound lowerBound, IndexScanBound upperBound, physical_op_id id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : ScanTable{type_, std::move(opInfo), id, std::move(printInfo)},
+          tableInfo{std::move(tableInfo)}, indexName{std::move(indexName)},
+          lowerBound{std::move(lowerBound)}, upperBound{std::move(upperBound)}, scanState{nullptr},
+          initialized{false}, cursor{0} {}
+
+    bool isSource() const override { return true; }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    bool isParallel() const override { return false; }
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<IndexScanNodeTable>(opInfo.copy(), tableInfo.copy(), indexName,
+            lowerBound.copy(), upperBound.copy(), id, printInfo->copy());
+    }
+
+private:
+    void lookupIndex(const transaction::Transaction* transaction);
+
+private:
+    ScanNodeTableInfo tableInfo;
+    std::string indexName;
+    IndexScanBound lowerBound;
+    IndexScanBound upperBound;
+    std::unique_ptr<storage::NodeTableScanState> scanState;
+    bool initialized;
+    std::vector<common::offset_t> offsets;
+    common::idx_t cursor;
+};
+
+} // namespace processor
+} // namespace kuzu
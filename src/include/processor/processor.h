@@ -19,6 +19,9 @@ public:
     inline common::TaskScheduler* getTaskScheduler() { return taskScheduler.get(); }
 
     std::shared_ptr<FactorizedTable> execute(PhysicalPlan* physicalPlan, ExecutionContext* context);
+    // Executes all pipelines the root pipeline depends on, leaving the root pipeline to be pulled
+    // from by the caller. Returns false if the root pipeline shouldn't be executed.
+    bool executeDependencies(PhysicalPlan* physicalPlan, ExecutionContext* context);
 
 private:
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
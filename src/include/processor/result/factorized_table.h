@@ -10,7 +10,8 @@
 namespace kuzu {
 namespace storage {
 class MemoryManager;
-}
+class Spiller;
+} // namespace storage
 namespace processor {
 
 struct BlockAppendingInfo {
@@ -37,6 +38,12 @@ public:
     // Manually set the underlying memory buffer to evicted to avoid double free
     void preventDestruction();
 
+    void spillToDisk(const storage::Spiller& spiller);
+    void loadFromDisk(const storage::Spiller& spiller);
+    // Drops a block reloaded by loadFromDisk from memory again. Changes since loading are lost.
+    void unloadToDisk(const storage::Spiller& spiller);
+    bool isSpilled() const;
+
     static void copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
         DataBlock* blockToCopyInto, ft_tuple_idx_t tupleIdxToCopyTo, uint32_t numTuplesToCopy,
         uint32_t numBytesPerTuple);
@@ -196,6 +203,16 @@ public:
         this->preventDestruction = preventDestruction;
     }
 
+    // Spills flat tuple blocks to disk. The last block is kept in memory if more tuples may be
+    // appended to the table. Unflat columns and the overflow buffer always stay in memory, so
+    // pointers into them stay valid. Returns the number of bytes spilled.
+    uint64_t spillFlatTupleBlocks(const storage::Spiller& spiller, bool keepLastBlock);
+    // Returns the number of bytes read back from disk.
+    uint64_t loadFlatTupleBlocks(const storage::Spiller& spiller);
+    void unloadFlatTupleBlocks(const storage::Spiller& spiller);
+    uint64_t getNumFlatTupleBlocks() const { return flatTupleBlockCollection->getBlocks().size(); }
+    uint64_t getNumResidentFlatTupleBlocks() const;
+
 private:
     void setOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx, ft_tuple_idx_t tupleIdx);
 
@@ -278,7 +295,15 @@ public:
 
     void resetState();
 
+    // Returns the index of the tuple the next flat tuple belongs to, and the index of the next
+    // flat tuple within that tuple.
+    std::pair<ft_tuple_idx_t, uint64_t> getNextFlatTuplePos() const;
+    // Skips flat tuples without reading them. The table must have at most one unflat group.
+    void skipFlatTuples(uint64_t numFlatTuplesToSkip);
+
 private:
+    void readNextTuple();
+
     // The dataChunkPos may be not consecutive, which means some entries in the
     // flatTuplePositionsInDataChunk is invalid. We put pair(UINT64_MAX, UINT64_MAX) in the
     // invalid entries.
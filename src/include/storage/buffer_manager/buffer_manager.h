@@ -26,6 +26,7 @@ class CopyTestHelper;
 }; // namespace testing
 namespace storage {
 class ChunkedNodeGroup;
+class MemoryManager;
 class Spiller;
 
 // This class keeps state info for pages potentially can be evicted.
@@ -191,6 +192,7 @@ class BufferManager {
 
     friend class FileHandle;
     friend class MemoryManager;
+    friend class Spiller;
 
 public:
     BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
@@ -292,6 +294,9 @@ private:
     std::vector<std::unique_ptr<FileHandle>> fileHandles;
     std::unique_ptr<Spiller> spiller;
     common::VirtualFileSystem* vfs;
+    // Memory manager allocating from this buffer manager. Its cached blocks are released when no
+    // memory can be reclaimed otherwise.
+    MemoryManager* memoryManager;
 };
 
 } // namespace storage
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <cstdint>
 #include <memory>
 #include <mutex>
-#include <stack>
+#include <vector>
 
 #include "common/system_config.h"
 #include "common/types/types.h"
@@ -45,6 +47,8 @@ public:
     // Manually set the evicted state of the buffer to avoid double free.
     void preventDestruction() { evicted = true; }
 
+    bool isEvicted() const { return evicted; }
+
 private:
     // Can be called multiple times safely
     void prepareLoadFromDisk();
@@ -72,6 +76,13 @@ private:
  * thread-safe, so that multiple threads can allocate/reclaim memory blocks with the same size class
  * at the same time.
  *
+ * To avoid contention between threads, free pages are kept in shards, each of which is used by a
+ * subset of the threads. A shard hands pages to and takes pages from the global free list in
+ * batches. Shards also cache freed blocks of the power-of-two sizes between MIN_CACHED_BLOCK_SIZE
+ * and MAX_CACHED_BLOCK_SIZE, which are allocated with malloc, so that blocks of those sizes can
+ * be reused without going through malloc and the buffer manager's memory accounting. Cached blocks
+ * remain accounted as used memory until they are released.
+ *
  * MM will return a MemoryBuffer to the caller, which is a wrapper of the allocated memory block,
  * and it will automatically call its allocator to reclaim the memory block when it is destroyed.
  */
@@ -81,9 +92,15 @@ class KUZU_API MemoryManager {
     friend class MmAllocator;
 
 public:
+    static constexpr uint64_t FREE_PAGE_BATCH_SIZE = 32;
+    static constexpr uint64_t MIN_CACHED_BLOCK_SIZE = 4 * 1024;
+    static constexpr uint64_t MAX_CACHED_BLOCK_SIZE = 1024 * 1024;
+    // Maximum number of bytes of malloc-backed blocks cached by a single shard.
+    static constexpr uint64_t MAX_CACHED_BYTES_PER_SHARD = 4 * MAX_CACHED_BLOCK_SIZE;
+
     MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs);
 
-    ~MemoryManager() = default;
+    ~MemoryManager();
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false,
         uint64_t size = common::TEMP_PAGE_SIZE);
@@ -91,7 +108,32 @@ public:
 
     BufferManager* getBufferManager() const { return bm; }
 
+    // Frees all blocks cached by the shards and returns the number of bytes freed.
+    uint64_t releaseCachedBlocks();
+
 private:
+    static constexpr uint64_t NUM_CACHED_BLOCK_SIZES =
+        std::countr_zero(MAX_CACHED_BLOCK_SIZE) - std::countr_zero(MIN_CACHED_BLOCK_SIZE) + 1;
+
+    struct AllocatorShard {
+        std::mutex mtx;
+        std::vector<common::page_idx_t> freePages;
+        // Cached blocks of each size class, indexed by getSizeClass.
+        std::array<std::vector<uint8_t*>, NUM_CACHED_BLOCK_SIZES> freeBlocks;
+        uint64_t numCachedBytes = 0;
+    };
+
+    // Returns the size class of blocks of the given size, or UINT64_MAX if blocks of that size
+    // are not cached.
+    static uint64_t getSizeClass(uint64_t size);
+    AllocatorShard& getShard() const;
+
+    // Allocates a block of the given size, which is backed by a page of the temp file if the size
+    // is TEMP_PAGE_SIZE (pageIdx is set accordingly), and by malloc otherwise.
+    std::span<uint8_t> allocateBlock(bool initializeToZero, uint64_t size,
+        common::page_idx_t& pageIdx);
+    // Caches the block in the current thread's shard if possible, and frees it otherwise.
+    void releaseBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
     void freeBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
     void updateUsedMemoryForFreedBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
     std::span<uint8_t> mallocBuffer(bool initializeToZero, uint64_t size);
@@ -100,8 +142,10 @@ private:
     FileHandle* fh;
     BufferManager* bm;
     common::page_offset_t pageSize;
-    std::stack<common::page_idx_t> freePages;
+    // Global free list shared by the shards. Shard locks must be acquired before this lock.
+    std::vector<common::page_idx_t> freePages;
     std::mutex allocatorLock;
+    std::vector<std::unique_ptr<AllocatorShard>> shards;
 };
 
 } // namespace storage
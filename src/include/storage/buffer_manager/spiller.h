@@ -12,6 +12,7 @@ class ChunkedNodeGroup;
 
 class BufferManager;
 class ColumnChunkData;
+class MemoryBuffer;
 
 // This should only be used with a LocalFileSystem
 class Spiller {
@@ -21,6 +22,17 @@ public:
     void clearUnusedChunk(ChunkedNodeGroup* nodeGroup);
     SpillResult spillToDisk(ColumnChunkData& chunk) const;
     void loadFromDisk(ColumnChunkData& chunk) const;
+    // Operator state (e.g. hash join partitions) is spilled at the granularity of memory buffers.
+    SpillResult spillToDisk(MemoryBuffer& buffer) const;
+    // Reloads a buffer written by spillToDisk. Does nothing if the buffer is already in memory.
+    void loadFromDisk(MemoryBuffer& buffer) const;
+    // Releases the memory of a buffer reloaded by loadFromDisk, reusing its existing copy on disk.
+    // Any changes made to the buffer since it was loaded are discarded.
+    SpillResult unloadToDisk(MemoryBuffer& buffer) const;
+    // Operators holding spilled state register themselves, so that the file isn't truncated by
+    // another query finishing while they still need to read from it.
+    void registerOperatorState() { numActiveOperatorStates++; }
+    void unregisterOperatorState() { numActiveOperatorStates--; }
     // reclaims memory from the next full partitioner group in the set
     // and returns the amount of memory reclaimed
     // If the set is empty, returns zero
@@ -30,6 +42,8 @@ public:
     ~Spiller();
 
 private:
+    SpillResult writeToDisk(MemoryBuffer& buffer) const;
+    void releaseFreedMemory(const SpillResult& result) const;
     FileHandle* getOrCreateDataFH() const;
     FileHandle* getDataFH() const;
 
@@ -39,6 +53,7 @@ private:
     common::VirtualFileSystem* vfs;
     std::unordered_set<ChunkedNodeGroup*> fullPartitionerGroups;
     std::atomic<FileHandle*> dataFH;
+    std::atomic<uint64_t> numActiveOperatorStates;
     std::mutex partitionerGroupsMtx;
     mutable std::mutex fileCreationMutex;
 };
@@ -109,6 +109,11 @@ enum class CompressionType : uint8_t {
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
     ALP = 4,
+    // Only used for string dictionary data. Pages store bytes as if uncompressed, each string is
+    // compressed with the symbol table in the FSSTMetadata.
+    FSST = 5,
+    // Bitpacked differences between consecutive values, see DeltaBitpacking.
+    DELTA_BITPACKING = 6,
 };
 
 struct ExtraMetadata {
@@ -132,6 +137,8 @@ struct ALPMetadata : ExtraMetadata {
     std::unique_ptr<ExtraMetadata> copy() override;
 };
 
+struct FSSTMetadata;
+
 struct InPlaceUpdateLocalState {
     struct FloatState {
         size_t newExceptionCount;
@@ -184,6 +191,7 @@ struct KUZU_API CompressionMetadata {
     inline ALPMetadata* floatMetadata() {
         return common::ku_dynamic_cast<ALPMetadata*>(getExtraMetadata());
     }
+    const FSSTMetadata* fsstMetadata() const;
 
     void serialize(common::Serializer& serializer) const;
     static CompressionMetadata deserialize(common::Deserializer& deserializer);
@@ -411,6 +419,63 @@ protected:
         const BitpackInfo<T>& header) const;
 };
 
+template<typename T>
+concept DeltaBitpackingType = std::same_as<T, int32_t> || std::same_as<T, int64_t> ||
+                              std::same_as<T, uint32_t> || std::same_as<T, uint64_t>;
+
+// Stores the differences between consecutive values, bitpacked relative to the smallest
+// difference. Values are grouped into blocks of BLOCK_SIZE, each starting with its first value in
+// full, so a value is decoded from the start of its block rather than of its page.
+// This suits sorted data such as CSR offsets and serial keys, whose differences are much narrower
+// than the values themselves.
+// The range of the differences is stored in the child metadata, while min and max are still the
+// bounds of the values. Values cannot be updated in place.
+template<DeltaBitpackingType T>
+class DeltaBitpacking : public CompressionAlg {
+    using U = common::numeric_utils::MakeUnSignedT<T>;
+    using S = common::numeric_utils::MakeSignedT<T>;
+
+public:
+    static constexpr common::idx_t DELTA_CHILD_IDX = 0;
+    // Multiple of the bitpacking chunk size, so that the differences of each block are packed in
+    // whole chunks.
+    static constexpr uint64_t BLOCK_SIZE = 1024;
+
+    DeltaBitpacking() = default;
+    DeltaBitpacking(const DeltaBitpacking&) = default;
+
+    // Returns the metadata for delta encoding the values, which include any null entries.
+    static CompressionMetadata getMetadata(std::span<const T> values, StorageValue min,
+        StorageValue max);
+
+    static uint8_t getBitWidth(const CompressionMetadata& metadata);
+
+    static uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata);
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override {
+        return CompressionType::DELTA_BITPACKING;
+    }
+
+private:
+    // Metadata of the bitpacked (difference - minimum difference) values.
+    static CompressionMetadata getPackedMetadata(const CompressionMetadata& metadata);
+    // Size of a full block: its first value followed by BLOCK_SIZE packed differences, the last
+    // of which is padding.
+    static uint64_t getBlockSizeInBytes(uint8_t bitWidth);
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
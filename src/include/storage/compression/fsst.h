@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include "storage/compression/compression.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Static symbol table used to compress string data (FSST). Each of the up to 255 one-byte codes
+// stands for a symbol of up to 8 bytes, and the escape code is followed by a literal byte.
+// Every string is encoded on its own, so a single string can be decompressed without reading its
+// neighbours. Encoding is deterministic: two strings are equal iff their encodings are equal.
+class FSSTSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr uint64_t MAX_NUM_SYMBOLS = 255;
+    static constexpr uint64_t MAX_SYMBOL_LENGTH = 8;
+
+    // Builds the table from a sample of the strings.
+    static FSSTSymbolTable build(const std::vector<std::string_view>& strings);
+
+    uint64_t getNumSymbols() const { return symbols.size(); }
+
+    // Appends the encoding of the string to the result.
+    void compress(std::string_view str, std::vector<uint8_t>& result) const;
+    // Returns the length of the string stored in the compressed bytes.
+    uint64_t getDecompressedLength(const uint8_t* data, uint64_t length) const;
+    // The result must have space for getDecompressedLength(data, length) bytes.
+    void decompress(const uint8_t* data, uint64_t length, uint8_t* result) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTSymbolTable deserialize(common::Deserializer& deserializer);
+
+private:
+    struct Symbol {
+        std::array<uint8_t, MAX_SYMBOL_LENGTH> bytes;
+        uint8_t length;
+    };
+
+    void addSymbol(const Symbol& symbol);
+    // Returns the code of the longest symbol that is a prefix of the data, or ESCAPE_CODE if there
+    // is none.
+    uint8_t findLongestSymbol(const uint8_t* data, uint64_t length) const;
+
+private:
+    std::vector<Symbol> symbols;
+    // Codes of the symbols starting with each byte, longest symbol first.
+    std::array<std::vector<uint8_t>, 256> codesByFirstByte;
+};
+
+struct FSSTMetadata : ExtraMetadata {
+    explicit FSSTMetadata(FSSTSymbolTable symbolTable) : symbolTable{std::move(symbolTable)} {}
+
+    FSSTSymbolTable symbolTable;
+
+    void serialize(common::Serializer& serializer) const { symbolTable.serialize(serializer); }
+    static FSSTMetadata deserialize(common::Deserializer& deserializer) {
+        return FSSTMetadata{FSSTSymbolTable::deserialize(deserializer)};
+    }
+
+    std::unique_ptr<ExtraMetadata> copy() override { return std::make_unique<FSSTMetadata>(*this); }
+};
+
+} // namespace storage
+} // namespace kuzu
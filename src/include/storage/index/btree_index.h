@@ -0,0 +1,168 @@
+#pragma once
+
+#include <concepts>
+
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/serializer.h"
+#include "index.h"
+
+namespace kuzu {
+namespace catalog {
+class Catalog;
+} // namespace catalog
+
+namespace storage {
+
+class NodeTable;
+
+template<typename T>
+concept BTreeIndexKey = std::integral<T> && !std::same_as<T, bool>;
+
+struct BTreeIndexStorageInfo final : IndexStorageInfo {
+    // Internal pages point to their children, so the pages of the tree can be anywhere in the data
+    // file. The root is a leaf if the height is 0.
+    common::page_idx_t rootPageIdx;
+    uint64_t height;
+    uint64_t numEntries;
+    // Node offsets below this have been indexed either when the index was created or on commit.
+    common::offset_t numIndexedRows;
+
+    BTreeIndexStorageInfo()
+        : rootPageIdx{common::INVALID_PAGE_IDX}, height{0}, numEntries{0}, numIndexedRows{0} {}
+    BTreeIndexStorageInfo(common::page_idx_t rootPageIdx, uint64_t height, uint64_t numEntries,
+        common::offset_t numIndexedRows)
+        : rootPageIdx{rootPageIdx}, height{height}, numEntries{numEntries},
+          numIndexedRows{numIndexedRows} {}
+
+    DELETE_COPY_DEFAULT_MOVE(BTreeIndexStorageInfo);
+
+    std::shared_ptr<common::BufferWriter> serialize() const override;
+
+    static std::unique_ptr<IndexStorageInfo> deserialize(
+        std::unique_ptr<common::BufferReader> reader);
+};
+
+// A bound of a range lookup. A null vector means the range is unbounded on that side.
+struct BTreeKeyBound {
+    const common::ValueVector* vector;
+    bool inclusive;
+
+    BTreeKeyBound() : vector{nullptr}, inclusive{true} {}
+    BTreeKeyBound(const common::ValueVector* vector, bool inclusive)
+        : vector{vector}, inclusive{inclusive} {}
+};
+
+struct BTreeKeyReader;
+
+// Entries committed since the last checkpoint are kept in memory and merged into the on-disk tree
+// at the next checkpoint. Lookups merge both parts.
+// Entries of updated or deleted rows can't be removed on commit, as older transactions may still
+// read the rows through them. Instead, they are checked against the committed values before the
+// next checkpoint, which removes the stale ones.
+class OnDiskBTree {
+public:
+    virtual ~OnDiskBTree() = default;
+
+    virtual void insert(const common::ValueVector& keyVector, common::sel_t pos,
+        common::offset_t offset) = 0;
+    // Marks the entry to be checked against the committed value of its row before the next
+    // checkpoint. If `insert` is set, the entry is also inserted.
+    virtual void markForCheck(const common::ValueVector& keyVector, common::sel_t pos,
+        common::offset_t offset, bool insert) = 0;
+    virtual void lookup(const BTreeKeyBound& lower, const BTreeKeyBound& upper,
+        std::vector<common::offset_t>& result) const = 0;
+    virtual void removeStaleEntries(BTreeKeyReader& reader) = 0;
+    virtual bool checkpoint(PageAllocator& pageAllocator) = 0;
+    virtual void reclaimStorage(PageAllocator& pageAllocator) const = 0;
+};
+
+class BTreeIndex final : public Index {
+public:
+    static constexpr const char* TYPE_NAME = "BTREE";
+
+    BTreeIndex(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storageInfo,
+        StorageManager* storageManager);
+
+    static std::unique_ptr<BTreeIndex> createNewIndex(IndexInfo indexInfo,
+        StorageManager* storageManager) {
+        return std::make_unique<BTreeIndex>(std::move(indexInfo),
+            std::make_unique<BTreeIndexStorageInfo>(), storageManager);
+    }
+
+    static bool isSupportedKeyType(common::PhysicalTypeID physicalType);
+
+    // Indexes all committed rows of the table starting from `numIndexedRows`.
+    void build(main::ClientContext* context, NodeTable& nodeTable);
+
+    // Collects the offsets of all entries within the bounds into `result` in ascending order.
+    // Entries of updated or deleted rows are kept until the next checkpoint, so callers must check
+    // the visibility of the returned offsets and re-evaluate the predicate on the current values.
+    void lookup(const BTreeKeyBound& lower, const BTreeKeyBound& upper,
+        std::vector<common::offset_t>& result) const {
+        btree->lookup(lower, upper, result);
+    }
+
+    std::unique_ptr<InsertState> initInsertState(main::ClientContext*, visible_func) override {
+        return std::make_unique<InsertState>();
+    }
+    void insert(transaction::Transaction*, const common::ValueVector&,
+        const std::vector<common::ValueVector*>&, InsertState&) override {
+        // DO NOTHING.
+        // Insertions are handled when the transaction commits.
+    }
+    bool needCommitInsert() const override { return true; }
+    void commitInsert(transaction::Transaction* transaction,
+        const common::ValueVector& nodeIDVector,
+        const std::vector<common::ValueVector*>& indexVectors, InsertState& insertState) override;
+
+    std::unique_ptr<UpdateState> initUpdateState(main::ClientContext* context,
+        common::column_id_t columnID, visible_func isVisible) override;
+    void update(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        common::ValueVector& propertyVector, UpdateState& updateState) override;
+
+    std::unique_ptr<DeleteState> initDeleteState(const transaction::Transaction* transaction,
+        MemoryManager* mm, visible_func isVisible) override;
+    void delete_(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        DeleteState& deleteState) override;
+
+    // Removes the entries of updated and deleted rows that no longer match the committed values.
+    void prepareCheckpoint(main::ClientContext* context) override;
+    void checkpoint(main::ClientContext*, PageAllocator& pageAllocator) override;
+    void finalize(main::ClientContext* context) override;
+    void reclaimStorage(PageAllocator& pageAllocator) const override {
+        btree->reclaimStorage(pageAllocator);
+    }
+
+    static std::unique_ptr<Index> load(main::ClientContext* context,
+        StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer);
+
+    static IndexType getIndexType() {
+        static const IndexType BTREE_INDEX_TYPE{TYPE_NAME,
+            IndexConstraintType::SECONDARY_NON_UNIQUE, IndexDefinitionType::BUILTIN, load};
+        return BTREE_INDEX_TYPE;
+    }
+
+    // Index catalog entries are loaded without their auxiliary info, which builtin indexes have to
+    // set themselves once the catalog is read.
+    static void loadCatalogEntries(const catalog::Catalog& catalog);
+
+private:
+    void updateNumIndexedRows(common::offset_t offset);
+    std::unique_ptr<BTreeKeyReader> initKeyReader(const transaction::Transaction* transaction,
+        MemoryManager* mm) const;
+
+private:
+    StorageManager* storageManager;
+    std::unique_ptr<OnDiskBTree> btree;
+};
+
+struct BTreeIndexAuxInfo final : catalog::IndexAuxInfo {
+    std::unique_ptr<IndexAuxInfo> copy() override { return std::make_unique<BTreeIndexAuxInfo>(); }
+
+    std::string toCypher(const catalog::IndexCatalogEntry& indexEntry,
+        const catalog::ToCypherInfo& info) const override;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -154,6 +154,11 @@ public:
     virtual void checkpointInMemory() {
         // DO NOTHING.
     };
+    // Called before the node groups of the indexed table are checkpointed, i.e. while the
+    // committed values of the table can still be scanned.
+    virtual void prepareCheckpoint(main::ClientContext*) {
+        // DO NOTHING.
+    }
     virtual void checkpoint(main::ClientContext*, PageAllocator&) {
         // DO NOTHING.
     }
@@ -163,6 +168,10 @@ public:
     virtual void finalize(main::ClientContext*) {
         // DO NOTHING.
     }
+    // Frees the pages of the index when its table is dropped.
+    virtual void reclaimStorage(PageAllocator&) const {
+        // DO NOTHING.
+    }
 
     std::span<uint8_t> getStorageBuffer() const {
         KU_ASSERT(!loaded);
@@ -199,6 +208,13 @@ public:
     KUZU_API void load(main::ClientContext* context, StorageManager* storageManager);
     bool needCommitInsert() const { return index->needCommitInsert(); }
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+    void prepareCheckpoint(main::ClientContext* context) {
+        if (loaded) {
+            KU_ASSERT(index);
+            index->prepareCheckpoint(context);
+        }
+    }
+    // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     void checkpoint(main::ClientContext* context, PageAllocator& pageAllocator) {
         if (loaded) {
             KU_ASSERT(index);
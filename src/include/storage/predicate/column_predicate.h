@@ -5,6 +5,11 @@
 #include "common/enums/zone_map_check_result.h"
 
 namespace kuzu {
+namespace common {
+class SelectionVector;
+class ValueVector;
+} // namespace common
+
 namespace storage {
 
 struct MergedColumnChunkStats;
@@ -20,8 +25,13 @@ public:
     }
     void tryAddPredicate(const binder::Expression& column, const binder::Expression& predicate);
     bool isEmpty() const { return predicates.empty(); }
+    const std::vector<std::unique_ptr<ColumnPredicate>>& getPredicates() const {
+        return predicates;
+    }
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const;
+    // Removes the selected positions whose values do not satisfy all predicates.
+    void filter(const common::ValueVector& vector, common::SelectionVector& selVector) const;
 
     std::string toString() const;
 
@@ -41,6 +51,10 @@ public:
     virtual ~ColumnPredicate() = default;
 
     virtual common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const = 0;
+    // Removes the selected positions whose values do not satisfy the predicate. Predicates which
+    // cannot be evaluated on the scanned values keep all positions.
+    virtual void filter(const common::ValueVector& /*vector*/,
+        common::SelectionVector& /*selVector*/) const {}
 
     virtual std::string toString();
 
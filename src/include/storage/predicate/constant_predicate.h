@@ -14,9 +14,13 @@ public:
         : ColumnPredicate{std::move(columnName), expressionType}, value{std::move(value)} {}
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+    void filter(const common::ValueVector& vector,
+        common::SelectionVector& selVector) const override;
 
     std::string toString() override;
 
+    const common::Value& getValue() const { return value; }
+
     std::unique_ptr<ColumnPredicate> copy() const override {
         return std::make_unique<ColumnConstantPredicate>(columnName, expressionType, value);
     }
@@ -15,6 +15,8 @@ public:
     }
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+    void filter(const common::ValueVector& vector,
+        common::SelectionVector& selVector) const override;
 
     std::unique_ptr<ColumnPredicate> copy() const override {
         return std::make_unique<ColumnNullPredicate>(columnName, expressionType);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "storage/file_handle.h"
 
 namespace kuzu {
@@ -18,16 +20,14 @@ struct ShadowFileHeader {
 };
 
 class BufferManager;
-// NOTE: This class is NOT thread-safe for now, as we are not checkpointing in parallel yet.
+// Shadow pages can be created concurrently, as node groups are checkpointed in parallel. Applying,
+// flushing and clearing the shadow file is done by a single thread.
 class ShadowFile {
 public:
     ShadowFile(BufferManager& bm, common::VirtualFileSystem* vfs, const std::string& databasePath);
 
     // TODO(Guodong): Remove originalFile param.
-    bool hasShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage) const {
-        return shadowPagesMap.contains(originalFile) &&
-               shadowPagesMap.at(originalFile).contains(originalPage);
-    }
+    bool hasShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage) const;
     void clearShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage);
     common::page_idx_t getShadowPage(common::file_idx_t originalFile,
         common::page_idx_t originalPage) const;
@@ -49,6 +49,11 @@ public:
     static void replayShadowPageRecords(main::ClientContext& context);
 
 private:
+    bool hasShadowPageNoLock(common::file_idx_t originalFile,
+        common::page_idx_t originalPage) const {
+        return shadowPagesMap.contains(originalFile) &&
+               shadowPagesMap.at(originalFile).contains(originalPage);
+    }
     FileHandle* getOrCreateShadowingFH();
 
 private:
@@ -63,6 +68,9 @@ private:
         std::unordered_map<common::page_idx_t, common::page_idx_t>>
         shadowPagesMap;
     std::vector<ShadowPageRecord> shadowPageRecords;
+    // Protects shadowPagesMap and shadowPageRecords. Shadow pages are added to the shadowing file
+    // in the order of shadowPageRecords.
+    mutable std::mutex mtx;
 };
 
 } // namespace storage
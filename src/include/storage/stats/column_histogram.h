@@ -0,0 +1,79 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+class Value;
+class ValueVector;
+} // namespace common
+
+namespace storage {
+
+// Equi-depth histogram and most common values (MCVs) of a column, built from a sample of its
+// values. The histogram only covers the values that are not MCVs.
+class ColumnHistogram {
+public:
+    static constexpr uint64_t NUM_BUCKETS = 32;
+    static constexpr uint64_t MAX_NUM_MOST_COMMON_VALUES = 16;
+
+    explicit ColumnHistogram(std::vector<double> sampledValues);
+
+    // Estimates the fraction of values equal to `value`.
+    double estimateEqualitySelectivity(double value,
+        common::cardinality_t numDistinctValues) const;
+    // Estimates the fraction of values within the given bounds. A missing bound is unbounded.
+    double estimateRangeSelectivity(std::optional<double> lowerBound, bool lowerInclusive,
+        std::optional<double> upperBound, bool upperInclusive) const;
+
+private:
+    // Estimates the fraction of non-MCV values smaller than `value`.
+    double getFractionBelow(double value) const;
+
+private:
+    // MCVs and the fraction of values equal to each of them.
+    std::vector<std::pair<double, double>> mostCommonValues;
+    // Fraction of values that are not MCVs.
+    double otherFraction;
+    // NUM_BUCKETS + 1 bounds of buckets holding the same number of non-MCV values each.
+    std::vector<double> bucketBounds;
+};
+
+// Reservoir sample of the numeric values of a column. Samples of the same column can be merged,
+// so the sample of a table can be maintained from the samples of concurrent COPY and insertions.
+class ColumnSample {
+public:
+    static constexpr uint64_t CAPACITY = 512;
+
+    ColumnSample() : numValues{0} {}
+
+    // Whether values of the given physical type can be sampled.
+    static bool isSampled(common::PhysicalTypeID physicalType);
+    // Returns the value as it would be sampled, or nothing if the value can't be sampled.
+    static std::optional<double> getSampleValue(const common::Value& value);
+
+    void update(const common::ValueVector& vector);
+    void merge(const ColumnSample& other);
+
+    bool empty() const { return values.empty(); }
+    ColumnHistogram buildHistogram() const { return ColumnHistogram{values}; }
+
+    void serialize(common::Serializer& serializer) const;
+    static ColumnSample deserialize(common::Deserializer& deserializer);
+
+private:
+    void insert(double value);
+
+private:
+    std::vector<double> values;
+    // Number of values the sample is drawn from.
+    common::cardinality_t numValues;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <mutex>
 #include <optional>
 
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "common/vector/value_vector.h"
+#include "storage/stats/column_histogram.h"
 #include "storage/stats/hyperloglog.h"
 
 namespace kuzu {
@@ -18,6 +20,10 @@ public:
 
     common::cardinality_t getNumDistinctValues() const { return hll ? hll->count() : 0; }
 
+    // Returns the histogram of the column if its values are sampled. The histogram is built on
+    // the first call after the sample changes.
+    const ColumnHistogram* getHistogram() const;
+
     void update(const common::ValueVector* vector);
 
     void merge(const ColumnStats& other) {
@@ -25,6 +31,10 @@ public:
             KU_ASSERT(other.hll);
             hll->merge(*other.hll);
         };
+        if (sample && other.sample) {
+            sample->merge(*other.sample);
+            resetHistogram();
+        }
     }
 
     void serialize(common::Serializer& serializer) const {
@@ -34,26 +44,35 @@ public:
             serializer.writeDebuggingInfo("hll");
             hll->serialize(serializer);
         }
-    }
-
-    static ColumnStats deserialize(common::Deserializer& deserializer) {
-        ColumnStats columnStats;
-        std::string info;
-        deserializer.validateDebuggingInfo(info, "has_hll");
-        bool hasHll = false;
-        deserializer.deserializeValue(hasHll);
-        if (hasHll) {
-            deserializer.validateDebuggingInfo(info, "hll");
-            columnStats.hll = HyperLogLog::deserialize(deserializer);
+        serializer.writeDebuggingInfo("has_sample");
+        serializer.serializeValue(sample.has_value());
+        if (sample) {
+            serializer.writeDebuggingInfo("sample");
+            sample->serialize(serializer);
         }
-        return columnStats;
     }
 
+    static ColumnStats deserialize(common::Deserializer& deserializer);
+
+private:
+    ColumnStats(const ColumnStats& other)
+        : hll{other.hll}, sample{other.sample}, histogram{other.histogram}, hashes{nullptr} {}
+
+    void resetHistogram() { histogram = std::make_shared<CachedHistogram>(); }
+
 private:
-    ColumnStats(const ColumnStats& other) : hll{other.hll}, hashes{nullptr} {}
+    struct CachedHistogram {
+        std::mutex mtx;
+        std::optional<ColumnHistogram> histogram;
+    };
 
 private:
     std::optional<HyperLogLog> hll;
+    // Sample of numeric values, from which histograms are built for selectivity estimation.
+    std::optional<ColumnSample> sample;
+    // Histogram built from the sample. Copies of the stats share it until their sample changes, so
+    // the estimates of all queries on the same sample use a histogram built once.
+    std::shared_ptr<CachedHistogram> histogram = std::make_shared<CachedHistogram>();
     // Preallocated vector for hash values.
     std::unique_ptr<common::ValueVector> hashes;
 };
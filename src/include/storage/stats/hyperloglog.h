@@ -11,15 +11,17 @@
 namespace kuzu {
 namespace storage {
 
-class HyperLogLog {
+// Sketch with 2^P registers. The standard error of its estimates is about 1.04 / sqrt(2^P).
+template<common::cardinality_t P_>
+class HyperLogLogSketch {
 public:
-    static constexpr common::cardinality_t P = 6;
+    static constexpr common::cardinality_t P = P_;
     static constexpr common::cardinality_t Q = 64 - P;
     static constexpr common::cardinality_t M = 1 << P;
     static constexpr double ALPHA = 0.721347520444481703680; // 1 / (2 log(2))
 
 public:
-    HyperLogLog() : k{} {} // NOLINT(*-pro-type-member-init)
+    HyperLogLogSketch() : k{} {} // NOLINT(*-pro-type-member-init)
 
     //! Algorithm 1
     void insertElement(common::hash_t h) {
@@ -37,10 +39,10 @@ public:
     common::cardinality_t count() const;
 
     //! Algorithm 2
-    void merge(const HyperLogLog& other);
+    void merge(const HyperLogLogSketch& other);
 
     void serialize(common::Serializer& serializer) const;
-    static HyperLogLog deserialize(common::Deserializer& deserializer);
+    static HyperLogLogSketch deserialize(common::Deserializer& deserializer);
 
     //! Algorithm 4
     void extractCounts(uint32_t* c) const;
@@ -51,5 +53,8 @@ private:
     std::array<uint8_t, M> k;
 };
 
+// Sketch of the column stats. Every column of the database keeps one, so it is kept small.
+using HyperLogLog = HyperLogLogSketch<6>;
+
 } // namespace storage
 } // namespace kuzu
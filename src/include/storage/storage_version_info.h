@@ -13,7 +13,7 @@ using storage_version_t = uint64_t;
 
 struct StorageVersionInfo {
     static std::unordered_map<std::string, storage_version_t> getStorageVersionInfo() {
-        return {{"0.11.1", 39}, {"0.11.0", 39}, {"0.10.0", 38}, {"0.9.0", 37}, {"0.8.0", 36},
+        return {{"0.11.1", 40}, {"0.11.0", 39}, {"0.10.0", 38}, {"0.9.0", 37}, {"0.8.0", 36},
             {"0.7.1.1", 35}, {"0.7.0", 34}, {"0.6.0.6", 33}, {"0.6.0.5", 32}, {"0.6.0.2", 31},
             {"0.6.0.1", 31}, {"0.6.0", 28}, {"0.5.0", 28}, {"0.4.2", 27}, {"0.4.1", 27},
             {"0.4.0", 27}, {"0.3.2", 26}, {"0.3.1", 26}, {"0.3.0", 26}, {"0.2.1", 25},
@@ -24,6 +24,14 @@ struct StorageVersionInfo {
 
     static KUZU_API storage_version_t getStorageVersion();
 
+    // Oldest storage version whose database files can still be read. Readers of the parts of the
+    // layout changed since then check the storage version of the file.
+    static constexpr storage_version_t MIN_SUPPORTED_STORAGE_VERSION = 39;
+    // Storage version 40 changed the layout of column stats, which now contain a sample of the
+    // column values. It also added B-tree indexes and the FSST and delta bitpacking compressions,
+    // which files of older versions never contain.
+    static constexpr storage_version_t COLUMN_SAMPLE_STORAGE_VERSION = 40;
+
     static constexpr const char* MAGIC_BYTES = "KUZU";
 };
 
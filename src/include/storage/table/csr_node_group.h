@@ -157,6 +157,11 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
         Column* csrOffsetCol, Column* csrLengthCol)
         : NodeGroupCheckpointState{std::move(columnIDs), std::move(columns), pageAllocator, mm},
           csrOffsetColumn{csrOffsetCol}, csrLengthColumn{csrLengthCol} {}
+
+    std::unique_ptr<NodeGroupCheckpointState> copy() const override {
+        return std::make_unique<CSRNodeGroupCheckpointState>(columnIDs, columns, pageAllocator, mm,
+            csrOffsetColumn, csrLengthColumn);
+    }
 };
 
 static constexpr common::column_id_t NBR_ID_COLUMN_ID = 0;
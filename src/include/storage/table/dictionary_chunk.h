@@ -6,6 +6,7 @@
 namespace kuzu {
 namespace storage {
 class MemoryManager;
+class FSSTSymbolTable;
 
 class DictionaryChunk {
 public:
@@ -50,6 +51,12 @@ public:
 
     void flush(PageAllocator& pageAllocator);
 
+    // Returns a copy of the dictionary with its string data compressed with FSST, or nullptr if
+    // compression is disabled or would not save any pages.
+    std::unique_ptr<DictionaryChunk> compressWithFSST() const;
+    // Decompresses string data which was scanned from an FSST compressed column.
+    void decompressFSST(const FSSTSymbolTable& symbolTable);
+
 private:
     bool enableCompression;
     // String data is stored as a UINT8 chunk, using the numValues in the chunk to track the number
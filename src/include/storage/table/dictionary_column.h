@@ -31,8 +31,10 @@ public:
 private:
     void scanOffsets(const ChunkState& state, DictionaryChunk::string_offset_t* offsets,
         uint64_t index, uint64_t numValues, uint64_t dataSize) const;
+    // compressedBuffer holds the compressed bytes of FSST strings and is reused across calls.
     void scanValueToVector(const ChunkState& dataState, uint64_t startOffset, uint64_t endOffset,
-        common::ValueVector* resultVector, uint64_t offsetInVector) const;
+        common::ValueVector* resultVector, uint64_t offsetInVector,
+        std::vector<uint8_t>& compressedBuffer) const;
 
     static bool canDataCommitInPlace(const ChunkState& dataState, uint64_t totalStringLengthToAdd);
     bool canOffsetCommitInPlace(const ChunkState& offsetState, const ChunkState& dataState,
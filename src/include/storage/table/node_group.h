@@ -55,6 +55,11 @@ struct NodeGroupCheckpointState {
           pageAllocator{pageAllocator}, mm{mm} {}
     virtual ~NodeGroupCheckpointState() = default;
 
+    // Node groups can be checkpointed concurrently, each thread working on its own copy.
+    virtual std::unique_ptr<NodeGroupCheckpointState> copy() const {
+        return std::make_unique<NodeGroupCheckpointState>(columnIDs, columns, pageAllocator, mm);
+    }
+
     template<typename T>
     const T& cast() const {
         return common::ku_dynamic_cast<const T&>(*this);
@@ -5,6 +5,9 @@
 #include "storage/table/node_group.h"
 
 namespace kuzu {
+namespace main {
+class ClientContext;
+}
 namespace transaction {
 class Transaction;
 }
@@ -77,7 +80,8 @@ public:
 
     uint64_t getEstimatedMemoryUsage() const;
 
-    void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
+    void checkpoint(main::ClientContext* context, MemoryManager& memoryManager,
+        NodeGroupCheckpointState& state);
     void reclaimStorage(PageAllocator& pageAllocator) const;
 
     TableStats getStats() const {
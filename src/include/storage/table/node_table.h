@@ -163,6 +163,10 @@ public:
     std::optional<std::reference_wrapper<IndexHolder>> getIndexHolder(const std::string& name);
     std::optional<Index*> getIndex(const std::string& name) const;
     std::vector<IndexHolder>& getIndexes() { return indexes; }
+    void scanCommittedIndexColumns(main::ClientContext* context,
+        IndexScanHelper& scanHelper) const {
+        scanIndexColumns(context, scanHelper, *nodeGroups);
+    }
 
     common::column_id_t getNumColumns() const { return columns.size(); }
     Column& getColumn(common::column_id_t columnID) {
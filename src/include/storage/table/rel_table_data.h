@@ -12,6 +12,9 @@ namespace kuzu {
 namespace catalog {
 class RelGroupCatalogEntry;
 }
+namespace main {
+class ClientContext;
+}
 namespace transaction {
 class Transaction;
 }
@@ -97,7 +100,7 @@ public:
     TableStats getStats() const { return nodeGroups->getStats(); }
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
-    void checkpoint(const std::vector<common::column_id_t>& columnIDs,
+    void checkpoint(main::ClientContext* context, const std::vector<common::column_id_t>& columnIDs,
         PageAllocator& pageAllocator);
 
     void pushInsertInfo(const transaction::Transaction* transaction, const CSRNodeGroup& nodeGroup,
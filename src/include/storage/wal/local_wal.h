@@ -43,7 +43,6 @@ public:
 
     void logLoadExtension(std::string path);
 
-    void logBeginTransaction();
     void logCommit();
 
     void clear();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <condition_variable>
+
 #include "storage/wal/wal_record.h"
 
 namespace kuzu {
@@ -15,7 +17,13 @@ public:
     WAL(const std::string& dbPath, bool readOnly, common::VirtualFileSystem* vfs);
     ~WAL();
 
-    void logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context);
+    // Appends the records of a committed transaction to the WAL buffer and returns the sequence
+    // number of the commit. The commit is durable only after syncCommittedWAL() returns.
+    uint64_t logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context);
+    // Waits until the commit with the given sequence number is synced to disk. Concurrent
+    // committers are synced together: the first one to arrive becomes the leader, optionally waits
+    // up to the group commit delay for more commits, and syncs all commits appended so far.
+    void syncCommittedWAL(uint64_t commitSeq, main::ClientContext* context);
     void logAndFlushCheckpoint(main::ClientContext* context);
 
     // Clear any buffer in the WAL writer. Also truncate the WAL file to 0 bytes.
@@ -29,6 +37,7 @@ private:
     void initWriter(main::ClientContext* context);
     void addNewWALRecordNoLock(const WALRecord& walRecord);
     void flushAndSyncNoLock();
+    void waitForSyncNoLock(std::unique_lock<std::mutex>& lck);
 
 private:
     std::mutex mtx;
@@ -39,6 +48,10 @@ private:
     std::unique_ptr<common::FileInfo> fileInfo;
     std::shared_ptr<common::BufferedFileWriter> writer;
     std::unique_ptr<common::Serializer> serializer;
+    std::condition_variable syncCV;
+    uint64_t lastCommitSeq;
+    uint64_t lastSyncedCommitSeq;
+    bool isSyncing;
 };
 
 } // namespace storage
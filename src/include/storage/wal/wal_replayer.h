@@ -21,6 +21,12 @@ private:
     };
 
     void replayWALRecord(WALRecord& walRecord) const;
+    // Whether the record only modifies the data of its own table, so records of different tables
+    // can be replayed concurrently.
+    bool canReplayInParallel(const WALRecord& walRecord) const;
+    // Replays consecutive table records of a transaction. Records of the same table are replayed
+    // in order, and different tables are replayed in parallel.
+    void replayTableRecords(const std::vector<std::unique_ptr<WALRecord>>& walRecords) const;
     void replayCreateCatalogEntryRecord(WALRecord& walRecord) const;
     void replayDropCatalogEntryRecord(const WALRecord& walRecord) const;
     void replayAlterTableEntryRecord(const WALRecord& walRecord) const;
@@ -115,7 +115,8 @@ public:
 
     bool shouldForceCheckpoint() const;
 
-    void commit(storage::WAL* wal);
+    // Returns the WAL sequence number of the commit, or 0 if nothing is logged to the WAL.
+    uint64_t commit(storage::WAL* wal);
     void rollback(storage::WAL* wal);
 
     storage::LocalStorage* getLocalStorage() const { return localStorage.get(); }
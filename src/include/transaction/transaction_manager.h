@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -33,9 +34,14 @@ class TransactionManager {
         main::ClientContext& clientContext);
 
 public:
+    // A pending checkpoint is overdue once it has been pending for this long, or once the WAL has
+    // grown by another checkpoint threshold since it became pending.
+    static constexpr uint64_t MAX_PENDING_CHECKPOINT_AGE_IN_MICROS = 60000000;
+
     // Timestamp starts from 1. 0 is reserved for the dummy system transaction.
     explicit TransactionManager(storage::WAL& wal)
-        : wal{wal}, lastTransactionID{Transaction::START_TRANSACTION_ID}, lastTimestamp{1} {
+        : wal{wal}, lastTransactionID{Transaction::START_TRANSACTION_ID}, lastTimestamp{1},
+          hasPendingCheckpoint{false} {
         initCheckpointerFunc = initCheckpointer;
     }
 
@@ -49,6 +55,17 @@ public:
 private:
     bool hasNoActiveTransactions() const;
     void checkpointNoLock(main::ClientContext& clientContext);
+    // Runs the deferred auto checkpoint if the last active transaction has left the system.
+    void runPendingCheckpointNoLock(main::ClientContext& clientContext);
+    // Same as above, but a failed checkpoint is not reported to the caller. The checkpoint stays
+    // pending and is retried by the next transaction leaving the system.
+    void tryRunPendingCheckpointNoLock(main::ClientContext& clientContext);
+    void setPendingCheckpointNoLock();
+    bool isPendingCheckpointOverdueNoLock(const main::ClientContext& clientContext);
+    // Transactions arriving continuously would keep a pending checkpoint from ever running. Once it
+    // is overdue, new transactions wait for the active ones to leave, the last of which runs it.
+    void waitForOverdueCheckpointNoLock(const main::ClientContext& clientContext,
+        std::unique_lock<std::mutex>& publicFunctionLck);
 
     // This functions locks the mutex to start new transactions.
     common::UniqLock stopNewTransactionsAndWaitUntilAllTransactionsLeave();
@@ -73,6 +90,11 @@ private:
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
     uint64_t checkpointWaitTimeoutInMicros = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS;
+    // Set when an auto checkpoint is due while other transactions are active. The checkpoint is
+    // then run by the commit of the last transaction leaving the system.
+    bool hasPendingCheckpoint;
+    std::chrono::steady_clock::time_point pendingCheckpointStartTime;
+    uint64_t pendingCheckpointWALSize = 0;
 
     init_checkpointer_func_t initCheckpointerFunc;
 };
@@ -1,6 +1,7 @@
 #include "main/client_context.h"
 
 #include "binder/binder.h"
+#include "binder/expression/parameter_expression.h"
 #include "common/exception/checkpoint.h"
 #include "common/exception/connection.h"
 #include "common/exception/runtime.h"
@@ -15,11 +16,14 @@
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/plan_cache.h"
+#include "main/query_result_stream.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
 #include "planner/planner.h"
+#include "processor/operator/result_collector.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -76,6 +80,9 @@ ClientContext::~ClientContext() {
     if (preventTransactionRollbackOnDestruction) {
         return;
     }
+    if (activeStream != nullptr) {
+        activeStream->finishNoLock(false /* commit */);
+    }
     if (getTransaction()) {
         getDatabase()->transactionManager->rollback(*this, getTransaction());
     }
@@ -337,6 +344,26 @@ void ClientContext::cleanUp() {
 std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_view query,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams) {
     std::unique_lock lck{mtx};
+    // The binder deals with the parameter values as shared ptrs
+    // Copy the params to a new map that matches the format that the binder expects
+    std::unordered_map<std::string, std::shared_ptr<Value>> inputParamsTmp;
+    for (auto& [key, value] : inputParams) {
+        inputParamsTmp.insert(std::make_pair(key, std::make_shared<Value>(*value)));
+    }
+    auto normalizedQuery = PlanCache::normalizeQuery(query);
+    std::string planCacheKey;
+    if (canUsePlanCacheNoLock()) {
+        planCacheKey = getPlanCacheKey(normalizedQuery, true /* isPrepare */, inputParamsTmp);
+        auto [preparedStatement, cachedStatement] =
+            lookUpPlanCacheNoLock(planCacheKey, inputParamsTmp);
+        if (preparedStatement != nullptr) {
+            cachedStatement->normalizedQuery = std::move(normalizedQuery);
+            preparedStatement->cachedPreparedStatementName =
+                cachedPreparedStatementManager.addStatement(std::move(cachedStatement));
+            useInternalCatalogEntry_ = false;
+            return std::move(preparedStatement);
+        }
+    }
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
@@ -347,15 +374,11 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_
         return PreparedStatement::getPreparedStatementWithError(
             "Connection Exception: We do not support prepare multiple statements.");
     }
-
-    // The binder deals with the parameter values as shared ptrs
-    // Copy the params to a new map that matches the format that the binder expects
-    std::unordered_map<std::string, std::shared_ptr<Value>> inputParamsTmp;
-    for (auto& [key, value] : inputParams) {
-        inputParamsTmp.insert(std::make_pair(key, std::make_shared<Value>(*value)));
-    }
     auto [preparedStatement, cachedStatement] = prepareNoLock(parsedStatements[0],
         true /*shouldCommitNewTransaction*/, std::move(inputParamsTmp));
+    cachedStatement->normalizedQuery = std::move(normalizedQuery);
+    cachedStatement->planCacheKey = std::move(planCacheKey);
+    addToPlanCacheNoLock(*preparedStatement, *cachedStatement);
     preparedStatement->cachedPreparedStatementName =
         cachedPreparedStatementManager.addStatement(std::move(cachedStatement));
     useInternalCatalogEntry_ = false;
@@ -399,10 +422,22 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     }
     // LCOV_EXCL_STOP
     auto cachedStatement = cachedPreparedStatementManager.getCachedStatement(name);
+    std::string planCacheKey;
+    if (canUsePlanCacheNoLock()) {
+        planCacheKey = getPlanCacheKey(cachedStatement->normalizedQuery, false /* isPrepare */,
+            preparedStatement->parameterMap);
+        auto [newPreparedStatement, newCachedStatement] =
+            lookUpPlanCacheNoLock(planCacheKey, preparedStatement->parameterMap);
+        if (newPreparedStatement != nullptr) {
+            useInternalCatalogEntry_ = false;
+            return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
+        }
+    }
     // rebind
     auto [newPreparedStatement, newCachedStatement] =
         prepareNoLock(cachedStatement->parsedStatement, false /*shouldCommitNewTransaction*/,
             preparedStatement->parameterMap);
+    newCachedStatement->planCacheKey = std::move(planCacheKey);
     useInternalCatalogEntry_ = false;
     return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
 }
@@ -415,18 +450,36 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
 
 std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     std::optional<uint64_t> queryID) {
+    std::string planCacheKey;
+    if (canUsePlanCacheNoLock()) {
+        planCacheKey = getPlanCacheKey(PlanCache::normalizeQuery(query), false /* isPrepare */,
+            {} /* parameters */);
+        auto [preparedStatement, cachedStatement] =
+            lookUpPlanCacheNoLock(planCacheKey, {} /* parameters */);
+        if (preparedStatement != nullptr) {
+            auto queryResult =
+                executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID);
+            useInternalCatalogEntry_ = false;
+            return queryResult;
+        }
+    }
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = parseQuery(query);
     } catch (std::exception& exception) {
         return QueryResult::getQueryResultWithError(exception.what());
     }
+    // Only plans of single-statement queries are cached, as they are looked up by the query text.
+    if (parsedStatements.size() > 1) {
+        planCacheKey.clear();
+    }
     std::unique_ptr<QueryResult> queryResult;
     QueryResult* lastResult = nullptr;
     double internalCompilingTime = 0.0, internalExecutionTime = 0.0;
     for (const auto& statement : parsedStatements) {
         auto [preparedStatement, cachedStatement] =
             prepareNoLock(statement, false /*shouldCommitNewTransaction*/);
+        cachedStatement->planCacheKey = planCacheKey;
         auto currentQueryResult =
             executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID);
         if (!currentQueryResult->isSuccess()) {
@@ -510,10 +563,12 @@ void ClientContext::validateTransaction(bool readOnly, bool requireTransaction)
 ClientContext::PrepareResult ClientContext::prepareNoLock(
     std::shared_ptr<Statement> parsedStatement, bool shouldCommitNewTransaction,
     std::optional<std::unordered_map<std::string, std::shared_ptr<Value>>> inputParams) {
+    finishActiveStreamNoLock();
     auto preparedStatement = std::make_unique<PreparedStatement>();
     auto cachedStatement = std::make_unique<CachedPreparedStatement>();
     cachedStatement->parsedStatement = parsedStatement;
     cachedStatement->useInternalCatalogEntry = useInternalCatalogEntry_;
+    cachedStatement->catalogVersion = getCatalog()->getVersion();
     auto prepareTimer = TimeMetric(true /* enable */);
     prepareTimer.start();
     try {
@@ -528,6 +583,7 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
         TransactionHelper::runFuncInTransaction(
             *transactionContext,
             [&]() -> void {
+                const ParameterValueScope parameterScope{cachedStatement->foldedParameters};
                 auto binder = Binder(this, localDatabase->getBinderExtensions());
                 if (inputParams) {
                     binder.setInputParameters(*inputParams);
@@ -560,9 +616,18 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     if (!preparedStatement->isSuccess()) {
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
     }
+    finishActiveStreamNoLock();
     useInternalCatalogEntry_ = cachedStatement->useInternalCatalogEntry;
     this->resetActiveQuery();
     this->startTimer();
+    if (canStreamResult(*preparedStatement, *cachedStatement)) {
+        auto queryResult = executeAndStreamNoLock(preparedStatement, cachedStatement,
+            queryID.has_value() ? *queryID : localDatabase->getNextQueryID());
+        if (queryResult->isSuccess()) {
+            addToPlanCacheNoLock(*preparedStatement, *cachedStatement);
+        }
+        return queryResult;
+    }
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::shared_ptr<FactorizedTable> resultFT;
@@ -580,6 +645,8 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
                 }
                 const auto executionContext =
                     std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
+                // The plan may be cached with other parameter values.
+                const ParameterValueScope parameterScope{preparedStatement->parameterMap};
                 auto mapper = PlanMapper(executionContext.get());
                 const auto physicalPlan = mapper.mapLogicalPlanToPhysical(
                     cachedStatement->logicalPlan.get(), cachedStatement->columns);
@@ -610,9 +677,208 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     queryResult->setColumnHeader(cachedStatement->getColumnNames(),
         cachedStatement->getColumnTypes());
     queryResult->initResultTableAndIterator(std::move(resultFT));
+    // The plan is cached only once it has been mapped, so that connections sharing it don't map it
+    // for the first time concurrently.
+    addToPlanCacheNoLock(*preparedStatement, *cachedStatement);
     return queryResult;
 }
 
+bool ClientContext::canUsePlanCacheNoLock() const {
+    // Plans bound in a manual transaction may depend on its uncommitted catalog changes, and plans
+    // reading attached databases or scan replacements depend on the state of this connection.
+    return getDBConfig()->planCacheSize > 0 && transactionContext->isAutoTransaction() &&
+           !hasDefaultDatabase() && getDatabaseManager()->getAttachedDatabases().empty() &&
+           scanReplacements.empty();
+}
+
+static void appendToPlanCacheKey(std::string& key, const std::string& str) {
+    // Length-prefixed, so that no two different lists of strings produce the same key.
+    key += std::to_string(str.size());
+    key += ':';
+    key += str;
+}
+
+std::string ClientContext::getPlanCacheKey(std::string_view normalizedQuery, bool isPrepare,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& parameters) const {
+    // Parameter types decide the types of the bound expressions, so plans are cached per parameter
+    // type. Parameter values are mapped per execution, unless the plan folds them (see
+    // CachedPlan::foldedParameters).
+    std::vector<std::string> parameterNames;
+    for (auto& [name, value] : parameters) {
+        if (value->getDataType().getLogicalTypeID() == LogicalTypeID::POINTER) {
+            return "";
+        }
+        parameterNames.push_back(name);
+    }
+    std::sort(parameterNames.begin(), parameterNames.end());
+    std::string key = isPrepare ? "P" : "E";
+    // Settings read during binding and planning.
+    for (auto setting : {uint64_t{clientConfig.varLengthMaxDepth},
+             static_cast<uint64_t>(clientConfig.recursivePatternSemantic),
+             uint64_t{clientConfig.recursivePatternCardinalityScaleFactor},
+             uint64_t{clientConfig.enableSemiMask}, uint64_t{clientConfig.enableZoneMap},
+             uint64_t{clientConfig.disableMapKeyCheck}, uint64_t{clientConfig.enablePlanOptimizer},
+             uint64_t{useInternalCatalogEntry()}}) {
+        appendToPlanCacheKey(key, std::to_string(setting));
+    }
+    for (auto& name : parameterNames) {
+        auto& value = *parameters.at(name);
+        appendToPlanCacheKey(key, name);
+        appendToPlanCacheKey(key, value.getDataType().toString());
+    }
+    appendToPlanCacheKey(key, std::string(normalizedQuery));
+    return key;
+}
+
+ClientContext::PrepareResult ClientContext::lookUpPlanCacheNoLock(const std::string& key,
+    const std::unordered_map<std::string, std::shared_ptr<Value>>& parameters) {
+    auto prepareTimer = TimeMetric(true /* enable */);
+    prepareTimer.start();
+    auto plan = localDatabase->getPlanCache()->lookUp(key, getCatalog()->getVersion(), parameters);
+    if (plan == nullptr) {
+        return {};
+    }
+    auto preparedStatement = std::make_unique<PreparedStatement>();
+    preparedStatement->preparedSummary.statementType = plan->statementType;
+    preparedStatement->readOnly = plan->readOnly;
+    // The plan is mapped with the new values of its parameters.
+    for (auto& [name, value] : plan->parameterMap) {
+        auto it = parameters.find(name);
+        preparedStatement->parameterMap.insert(
+            {name, std::make_shared<Value>(it != parameters.end() ? *it->second : *value)});
+    }
+    try {
+        validateTransaction(plan->readOnly, plan->parsedStatement->requireTransaction());
+    } catch (std::exception& exception) {
+        preparedStatement->success = false;
+        preparedStatement->errMsg = exception.what();
+    }
+    auto cachedStatement = std::make_unique<CachedPreparedStatement>();
+    cachedStatement->parsedStatement = plan->parsedStatement;
+    cachedStatement->useInternalCatalogEntry = useInternalCatalogEntry_;
+    cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(plan->logicalPlan.copy());
+    cachedStatement->columns = plan->columns;
+    cachedStatement->catalogVersion = plan->catalogVersion;
+    cachedStatement->foldedParameters = plan->foldedParameters;
+    prepareTimer.stop();
+    preparedStatement->preparedSummary.compilingTime = prepareTimer.getElapsedTimeMS();
+    return {std::move(preparedStatement), std::move(cachedStatement)};
+}
+
+static bool hasTableFunctionCall(const LogicalOperator& op) {
+    if (op.getOperatorType() == LogicalOperatorType::TABLE_FUNCTION_CALL) {
+        return true;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); i++) {
+        if (hasTableFunctionCall(*op.getChild(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ClientContext::addToPlanCacheNoLock(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedPreparedStatement) const {
+    if (cachedPreparedStatement.planCacheKey.empty() || !preparedStatement.isSuccess() ||
+        preparedStatement.getStatementType() != StatementType::QUERY ||
+        cachedPreparedStatement.parsedStatement->isInternal()) {
+        return;
+    }
+    // Table functions compute their output at bind time (e.g. from files, projected graphs or the
+    // state of the database), so their plans can't be reused.
+    if (hasTableFunctionCall(cachedPreparedStatement.logicalPlan->getLastOperatorRef())) {
+        return;
+    }
+    // The catalog may have changed while the statement was bound.
+    if (getCatalog()->getVersion() != cachedPreparedStatement.catalogVersion) {
+        return;
+    }
+    auto plan = std::make_shared<CachedPlan>();
+    plan->parsedStatement = cachedPreparedStatement.parsedStatement;
+    plan->statementType = preparedStatement.getStatementType();
+    plan->readOnly = preparedStatement.isReadOnly();
+    // Parameter values are updated in place when executing, so they are copied.
+    for (auto& [name, value] : preparedStatement.parameterMap) {
+        plan->parameterMap.insert({name, std::make_shared<Value>(*value)});
+    }
+    plan->logicalPlan = cachedPreparedStatement.logicalPlan->copy();
+    plan->columns = cachedPreparedStatement.columns;
+    plan->catalogVersion = cachedPreparedStatement.catalogVersion;
+    plan->foldedParameters = cachedPreparedStatement.foldedParameters;
+    localDatabase->getPlanCache()->insert(cachedPreparedStatement.planCacheKey, std::move(plan),
+        getDBConfig()->planCacheSize);
+}
+
+bool ClientContext::canStreamResult(const PreparedStatement& preparedStatement,
+    const CachedPreparedStatement& cachedPreparedStatement) const {
+    // Only results of read-only queries in auto transactions are streamed, as the transaction has
+    // to stay open until the result is consumed.
+    return clientConfig.enableStreamingResults && preparedStatement.isReadOnly() &&
+           preparedStatement.getStatementType() == StatementType::QUERY &&
+           !cachedPreparedStatement.logicalPlan->isProfile() &&
+           transactionContext->isAutoTransaction();
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeAndStreamNoLock(
+    PreparedStatement* preparedStatement, CachedPreparedStatement* cachedStatement,
+    uint64_t queryID) {
+    auto executingTimer = TimeMetric(true /* enable */);
+    executingTimer.start();
+    std::shared_ptr<FactorizedTable> resultFT;
+    auto queryResult = std::make_unique<QueryResult>(preparedStatement->preparedSummary);
+    // Queries run through query() are executed in the auto transaction they were prepared in.
+    if (!transactionContext->hasActiveTransaction()) {
+        transactionContext->beginAutoTransaction(true /* readOnlyStatement */);
+    }
+    try {
+        auto profiler = std::make_unique<Profiler>();
+        auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this, queryID);
+        // The plan may be cached with other parameter values.
+        const ParameterValueScope parameterScope{preparedStatement->parameterMap};
+        auto mapper = PlanMapper(executionContext.get());
+        auto physicalPlan = mapper.mapLogicalPlanToPhysical(cachedStatement->logicalPlan.get(),
+            cachedStatement->columns);
+        auto root = physicalPlan->lastOperator.get();
+        if (root->getOperatorType() != PhysicalOperatorType::RESULT_COLLECTOR ||
+            root->constCast<ResultCollector>().getAccumulateType() != AccumulateType::REGULAR) {
+            resultFT = localDatabase->queryProcessor->execute(physicalPlan.get(),
+                executionContext.get());
+            transactionContext->commit();
+        } else {
+            resultFT = root->constCast<ResultCollector>().getResultFTable();
+            auto executeRoot = localDatabase->queryProcessor->executeDependencies(
+                physicalPlan.get(), executionContext.get());
+            queryResult->stream = std::make_unique<QueryResultStream>(this, std::move(profiler),
+                std::move(executionContext), std::move(physicalPlan));
+            if (executeRoot) {
+                queryResult->stream->initNoLock();
+            } else {
+                queryResult->stream->finishNoLock(true /* commit */);
+            }
+        }
+    } catch (std::exception& e) {
+        transactionContext->rollback();
+        return handleFailedExecution(queryID, e);
+    }
+    executingTimer.stop();
+    queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+    queryResult->setColumnHeader(cachedStatement->getColumnNames(),
+        cachedStatement->getColumnTypes());
+    queryResult->initResultTableAndIterator(std::move(resultFT));
+    return queryResult;
+}
+
+void ClientContext::finishActiveStreamNoLock() {
+    if (activeStream == nullptr) {
+        return;
+    }
+    try {
+        activeStream->fetchRemainingNoLock();
+    } catch (std::exception&) { // NOLINT(bugprone-empty-catch)
+        // The stream is finished and its transaction rolled back either way.
+    }
+}
+
 std::unique_ptr<QueryResult> ClientContext::handleFailedExecution(std::optional<uint64_t> queryID,
     const std::exception& e) const {
     getMemoryManager()->getBufferManager()->getSpillerOrSkip(
@@ -7,6 +7,7 @@
 #include "extension/transformer_extension.h"
 #include "main/client_context.h"
 #include "main/database_manager.h"
+#include "main/plan_cache.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 #if defined(_WIN32)
@@ -126,6 +127,7 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
         *memoryManager, dbConfig.enableCompression, vfs.get());
     transactionManager = std::make_unique<TransactionManager>(storageManager->getWAL());
     databaseManager = std::make_unique<DatabaseManager>();
+    planCache = std::make_unique<PlanCache>();
 
     extensionManager = std::make_unique<extension::ExtensionManager>();
     dbLifeCycleManager = std::make_shared<DatabaseLifeCycleManager>();
@@ -0,0 +1,132 @@
+#include "main/plan_cache.h"
+
+#include "common/string_utils.h"
+#include "common/types/value/value.h"
+
+namespace kuzu {
+namespace main {
+
+std::string PlanCache::normalizeQuery(std::string_view query) {
+    std::string result;
+    result.reserve(query.size());
+    char quote = 0;
+    bool pendingSpace = false, pendingNewline = false;
+    for (auto i = 0u; i < query.size(); i++) {
+        const auto c = query[i];
+        if (quote != 0) {
+            result += c;
+            if (c == '\\' && quote != '`' && i + 1 < query.size()) {
+                result += query[++i];
+            } else if (c == quote) {
+                quote = 0;
+            }
+            continue;
+        }
+        if (common::StringUtils::isSpace(c)) {
+            // Newlines are kept apart from other whitespace as they terminate line comments.
+            pendingNewline |= c == '\n';
+            pendingSpace = true;
+            continue;
+        }
+        if (pendingSpace && !result.empty()) {
+            result += pendingNewline ? '\n' : ' ';
+        }
+        pendingSpace = false;
+        pendingNewline = false;
+        if (c == '\'' || c == '"' || c == '`') {
+            quote = c;
+        }
+        result += c;
+    }
+    if (quote == 0 && !result.empty() && result.back() == ';') {
+        result.pop_back();
+        while (!result.empty() && common::StringUtils::isSpace(result.back())) {
+            result.pop_back();
+        }
+    }
+    return result;
+}
+
+bool CachedPlan::hasFoldedValues(
+    const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters) const {
+    for (auto& name : foldedParameters) {
+        // Parameters without values are bound as nulls, both in the cached plan and in a new one.
+        auto it = parameters.find(name);
+        auto boundIt = parameterMap.find(name);
+        if (it == parameters.end() || boundIt == parameterMap.end()) {
+            continue;
+        }
+        if (!(*it->second == *boundIt->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<const CachedPlan> PlanCache::lookUp(const std::string& key,
+    uint64_t catalogVersion,
+    const std::unordered_map<std::string, std::shared_ptr<common::Value>>& parameters) {
+    std::unique_lock lck{mtx};
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        numMisses++;
+        return nullptr;
+    }
+    if (it->second.plan->catalogVersion != catalogVersion) {
+        lruList.erase(it->second.lruPos);
+        entries.erase(it);
+        numMisses++;
+        return nullptr;
+    }
+    // The entry is kept, as it is replaced by the plan bound for the new values.
+    if (!it->second.plan->hasFoldedValues(parameters)) {
+        numMisses++;
+        return nullptr;
+    }
+    lruList.splice(lruList.begin(), lruList, it->second.lruPos);
+    numHits++;
+    return it->second.plan;
+}
+
+void PlanCache::insert(const std::string& key, std::shared_ptr<const CachedPlan> plan,
+    uint64_t capacity) {
+    std::unique_lock lck{mtx};
+    if (auto it = entries.find(key); it != entries.end()) {
+        it->second.plan = std::move(plan);
+        lruList.splice(lruList.begin(), lruList, it->second.lruPos);
+        return;
+    }
+    if (capacity == 0) {
+        return;
+    }
+    lruList.push_front(key);
+    entries.insert({key, Entry{std::move(plan), lruList.begin()}});
+    while (entries.size() > capacity) {
+        entries.erase(lruList.back());
+        lruList.pop_back();
+    }
+}
+
+void PlanCache::clear() {
+    std::unique_lock lck{mtx};
+    entries.clear();
+    lruList.clear();
+}
+
+uint64_t PlanCache::getNumEntries() {
+    std::unique_lock lck{mtx};
+    return entries.size();
+}
+
+uint64_t PlanCache::getNumHits() {
+    std::unique_lock lck{mtx};
+    return numHits;
+}
+
+uint64_t PlanCache::getNumMisses() {
+    std::unique_lock lck{mtx};
+    return numMisses;
+}
+
+} // namespace main
+} // namespace kuzu
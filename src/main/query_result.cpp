@@ -4,6 +4,7 @@
 
 #include "common/arrow/arrow_converter.h"
 #include "common/exception/runtime.h"
+#include "main/query_result_stream.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
 
@@ -22,6 +23,14 @@ QueryResult::QueryResult(const PreparedSummary& preparedSummary)
     querySummary->setPreparedSummary(preparedSummary);
 }
 QueryResult::~QueryResult() {
+    if (stream) {
+        if (dbLifeCycleManager && dbLifeCycleManager->isDatabaseClosed) {
+            // The plan of an unfinished stream can't be destructed once the database is closed.
+            (void)stream.release();
+        } else {
+            stream->finish();
+        }
+    }
     if (!dbLifeCycleManager) {
         return;
     }
@@ -58,6 +67,10 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 
 uint64_t QueryResult::getNumTuples() const {
     checkDatabaseClosedOrThrow();
+    if (stream) {
+        stream->fetchRemaining();
+        return stream->getNumDiscardedTuples() + factorizedTable->getTotalNumFlatTuples();
+    }
     return factorizedTable->getTotalNumFlatTuples();
 }
 
@@ -68,6 +81,13 @@ QuerySummary* QueryResult::getQuerySummary() const {
 
 void QueryResult::resetIterator() {
     checkDatabaseClosedOrThrow();
+    if (stream) {
+        stream->fetchRemaining();
+        if (stream->getNumDiscardedTuples() > 0) {
+            throw RuntimeException("Cannot reset the iterator of a streamed query result after "
+                                   "its tuples have been consumed.");
+        }
+    }
     iterator->resetState();
 }
 
@@ -108,6 +128,10 @@ void QueryResult::initResultTableAndIterator(
 bool QueryResult::hasNext() const {
     checkDatabaseClosedOrThrow();
     validateQuerySucceed();
+    while (stream && !iterator->hasNextFlatTuple() && !stream->isFinished()) {
+        stream->fetchNextBatch();
+        iterator->resetState();
+    }
     return iterator->hasNextFlatTuple();
 }
 
@@ -148,6 +172,9 @@ std::string QueryResult::toString() const {
             result += columnNames[i];
         }
         result += "\n";
+        if (stream) {
+            stream->fetchRemaining();
+        }
         auto [tuple, iterator] = getIterator();
         while (iterator->hasNextFlatTuple()) {
             iterator->getNextFlatTuple();
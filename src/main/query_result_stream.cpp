@@ -0,0 +1,108 @@
+#include "main/query_result_stream.h"
+
+#include "common/task_system/progress_bar.h"
+#include "main/client_context.h"
+#include "processor/operator/result_collector.h"
+#include "transaction/transaction_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace main {
+
+QueryResultStream::QueryResultStream(ClientContext* context, std::unique_ptr<Profiler> profiler,
+    std::unique_ptr<ExecutionContext> executionContext, std::unique_ptr<PhysicalPlan> physicalPlan)
+    : context{context}, profiler{std::move(profiler)},
+      executionContext{std::move(executionContext)}, physicalPlan{std::move(physicalPlan)},
+      resultCollector{this->physicalPlan->lastOperator->ptrCast<ResultCollector>()},
+      numDiscardedTuples{0}, finished{false} {}
+
+void QueryResultStream::initNoLock() {
+    context->activeStream = this;
+    try {
+        resultCollector->initGlobalState(executionContext.get());
+        resultSet = resultCollector->getResultSet(context->getMemoryManager());
+        resultCollector->initLocalState(resultSet.get(), executionContext.get());
+    } catch (std::exception&) {
+        finishNoLock(false /* commit */);
+        throw;
+    }
+    fetchNextBatchNoLock();
+}
+
+void QueryResultStream::fetchNextBatch() {
+    if (finished) {
+        return;
+    }
+    std::unique_lock lck{context->mtx};
+    fetchNextBatchNoLock();
+}
+
+void QueryResultStream::fetchNextBatchNoLock() {
+    // The stream may have been finished by the client context in the meantime.
+    if (finished) {
+        return;
+    }
+    auto table = resultCollector->getResultFTable();
+    numDiscardedTuples += table->getTotalNumFlatTuples();
+    table->clear();
+    if (!fetchNoLock(BATCH_SIZE)) {
+        finishNoLock(true /* commit */);
+    }
+}
+
+void QueryResultStream::fetchRemaining() {
+    if (finished) {
+        return;
+    }
+    std::unique_lock lck{context->mtx};
+    fetchRemainingNoLock();
+}
+
+void QueryResultStream::fetchRemainingNoLock() {
+    if (finished) {
+        return;
+    }
+    fetchNoLock(UINT64_MAX);
+    finishNoLock(true /* commit */);
+}
+
+bool QueryResultStream::fetchNoLock(uint64_t numTuples) {
+    try {
+        return resultCollector->fetchTuples(executionContext.get(), numTuples);
+    } catch (std::exception&) {
+        finishNoLock(false /* commit */);
+        throw;
+    }
+}
+
+void QueryResultStream::finish() {
+    if (finished) {
+        return;
+    }
+    std::unique_lock lck{context->mtx};
+    finishNoLock(false /* commit */);
+}
+
+void QueryResultStream::finishNoLock(bool commit) {
+    if (finished) {
+        return;
+    }
+    finished = true;
+    if (context->activeStream == this) {
+        context->activeStream = nullptr;
+    }
+    context->getProgressBar()->endProgress(executionContext->queryID);
+    // The result table is shared with the query result, so the plan can be released.
+    resultSet.reset();
+    physicalPlan.reset();
+    if (commit) {
+        context->getTransactionContext()->commit();
+    } else {
+        context->getTransactionContext()->rollback();
+    }
+}
+
+} // namespace main
+} // namespace kuzu
@@ -2,6 +2,8 @@
 
 #include "common/exception/runtime.h"
 #include "main/client_context.h"
+#include "main/database.h"
+#include "main/plan_cache.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
@@ -31,5 +33,26 @@ void SpillToDiskSetting::setContext(ClientContext* context, const common::Value&
     context->getMemoryManager()->getBufferManager()->resetSpiller(spillPath);
 }
 
+void GroupCommitDelaySetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto delay = parameter.getValue<int64_t>();
+    if (delay < 0) {
+        throw common::RuntimeException("group_commit_delay must be a non-negative number.");
+    }
+    context->getDBConfigUnsafe()->groupCommitDelayInMicros = delay;
+}
+
+void PlanCacheSizeSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto size = parameter.getValue<int64_t>();
+    if (size < 0) {
+        throw common::RuntimeException("plan_cache_size must be a non-negative number.");
+    }
+    context->getDBConfigUnsafe()->planCacheSize = size;
+    if (size == 0) {
+        context->getDatabase()->getPlanCache()->clear();
+    }
+}
+
 } // namespace main
 } // namespace kuzu
@@ -3,6 +3,9 @@
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
 #include "main/client_context.h"
 #include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_empty_result.h"
@@ -10,6 +13,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_table_function_call.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "storage/index/btree_index.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -177,6 +181,165 @@ static bool isConstantExpression(const std::shared_ptr<Expression> expression) {
     }
 }
 
+static bool isNodeProperty(const Expression& expression, const Expression& nodeID) {
+    if (expression.expressionType != ExpressionType::PROPERTY) {
+        return false;
+    }
+    auto& property = expression.constCast<PropertyExpression>();
+    return !property.isInternalID() &&
+           property.getVariableName() == nodeID.constCast<PropertyExpression>().getVariableName();
+}
+
+static ExpressionType reverseComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+namespace {
+
+// Bounds on a node property implied by comparisons with constants.
+struct PropertyRange {
+    std::shared_ptr<Expression> property;
+    std::shared_ptr<Expression> lowerBound = nullptr;
+    bool lowerInclusive = true;
+    std::shared_ptr<Expression> upperBound = nullptr;
+    bool upperInclusive = true;
+    bool isEquality = false;
+
+    explicit PropertyRange(std::shared_ptr<Expression> property) : property{std::move(property)} {}
+
+    void addComparison(ExpressionType type, std::shared_ptr<Expression> constant) {
+        if (isEquality) {
+            return;
+        }
+        switch (type) {
+        case ExpressionType::EQUALS: {
+            lowerBound = constant;
+            upperBound = std::move(constant);
+            lowerInclusive = upperInclusive = true;
+            isEquality = true;
+        } break;
+        case ExpressionType::GREATER_THAN:
+        case ExpressionType::GREATER_THAN_EQUALS: {
+            // Constants are not comparable at planning time, so we keep the first bound.
+            if (lowerBound == nullptr) {
+                lowerBound = std::move(constant);
+                lowerInclusive = type == ExpressionType::GREATER_THAN_EQUALS;
+            }
+        } break;
+        case ExpressionType::LESS_THAN:
+        case ExpressionType::LESS_THAN_EQUALS: {
+            if (upperBound == nullptr) {
+                upperBound = std::move(constant);
+                upperInclusive = type == ExpressionType::LESS_THAN_EQUALS;
+            }
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+    }
+
+    double getSelectivity() const {
+        if (isEquality) {
+            return PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
+        }
+        if (lowerBound != nullptr && upperBound != nullptr) {
+            return PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY *
+                   PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+        }
+        return PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+    }
+};
+
+} // namespace
+
+static std::vector<PropertyRange> getPropertyRanges(const Expression& nodeID,
+    const expression_vector& predicates) {
+    std::vector<PropertyRange> ranges;
+    for (auto& predicate : predicates) {
+        auto type = predicate->expressionType;
+        switch (type) {
+        case ExpressionType::EQUALS:
+        case ExpressionType::LESS_THAN:
+        case ExpressionType::LESS_THAN_EQUALS:
+        case ExpressionType::GREATER_THAN:
+        case ExpressionType::GREATER_THAN_EQUALS:
+            break;
+        default:
+            continue;
+        }
+        auto property = predicate->getChild(0);
+        auto constant = predicate->getChild(1);
+        if (!isNodeProperty(*property, nodeID)) {
+            // Normalize property to LHS.
+            std::swap(property, constant);
+            type = reverseComparison(type);
+        }
+        if (!isNodeProperty(*property, nodeID) || !isConstantExpression(constant) ||
+            property->dataType != constant->dataType) {
+            continue;
+        }
+        auto it = std::find_if(ranges.begin(), ranges.end(), [&](const PropertyRange& range) {
+            return range.property->getUniqueName() == property->getUniqueName();
+        });
+        if (it == ranges.end()) {
+            ranges.emplace_back(property);
+            it = ranges.end() - 1;
+        }
+        it->addComparison(type, std::move(constant));
+    }
+    return ranges;
+}
+
+// Try to answer the most selective property range with a btree index. Returns nullptr if no
+// range is covered by an index or if the range is not selective enough to beat a full scan.
+static std::unique_ptr<IndexScanInfo> tryGetIndexScanInfo(main::ClientContext* context,
+    table_id_t tableID, const Expression& nodeID, const expression_vector& predicates) {
+    auto ranges = getPropertyRanges(nodeID, predicates);
+    if (ranges.empty()) {
+        return nullptr;
+    }
+    auto catalog = context->getCatalog();
+    auto transaction = context->getTransaction();
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, tableID);
+    auto indexEntries = catalog->getIndexEntries(transaction, tableID);
+    const PropertyRange* bestRange = nullptr;
+    std::string bestIndexName;
+    for (auto& range : ranges) {
+        auto propertyName = range.property->constCast<PropertyExpression>().getPropertyName();
+        if (!tableEntry->containsProperty(propertyName) ||
+            range.getSelectivity() > PlannerKnobs::INDEX_SCAN_SELECTIVITY_THRESHOLD ||
+            (bestRange != nullptr && range.getSelectivity() >= bestRange->getSelectivity())) {
+            continue;
+        }
+        auto propertyID = tableEntry->getPropertyID(propertyName);
+        for (auto indexEntry : indexEntries) {
+            if (indexEntry->getIndexType() == BTreeIndex::TYPE_NAME && indexEntry->isLoaded() &&
+                indexEntry->getPropertyIDs() == std::vector{propertyID}) {
+                bestRange = &range;
+                bestIndexName = indexEntry->getIndexName();
+                break;
+            }
+        }
+    }
+    if (bestRange == nullptr) {
+        return nullptr;
+    }
+    return std::make_unique<IndexScanInfo>(bestIndexName, bestRange->property,
+        bestRange->lowerBound, bestRange->lowerInclusive, bestRange->upperBound,
+        bestRange->upperInclusive);
+}
+
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     auto& scan = op->cast<LogicalScanNodeTable>();
@@ -204,6 +367,17 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
             predicateSet.addPredicate(primaryKeyEqualityComparison);
         }
     }
+    if (tableIDs.size() == 1 && scan.getScanType() == LogicalScanNodeTableType::SCAN) {
+        // Predicates answered by the index are kept, so they are re-evaluated on the looked up
+        // rows. This also filters out stale index entries.
+        auto indexScanInfo =
+            tryGetIndexScanInfo(context, tableIDs[0], *nodeID, predicateSet.getAllPredicates());
+        if (indexScanInfo != nullptr) {
+            scan.setScanType(LogicalScanNodeTableType::INDEX_SCAN);
+            scan.setExtraInfo(std::move(indexScanInfo));
+            scan.computeFlatSchema();
+        }
+    }
     return finishPushDown(op);
 }
 
@@ -14,7 +14,7 @@ void LogicalOperatorCollector::collect(planner::LogicalOperator* op) {
 
 void LogicalIndexScanNodeCollector::visitScanNodeTable(planner::LogicalOperator* op) {
     auto scan = op->constCast<planner::LogicalScanNodeTable>();
-    if (scan.getScanType() == planner::LogicalScanNodeTableType::PRIMARY_KEY_SCAN) {
+    if (scan.getScanType() != planner::LogicalScanNodeTableType::SCAN) {
         ops.push_back(op);
     }
 }
@@ -1,6 +1,10 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
+#include "binder/expression/scalar_function_expression.h"
+#include "common/types/value/nested.h"
+#include "function/list/vector_list_functions.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/logical_aggregate.h"
@@ -149,40 +153,155 @@ static bool isSingleLabelledProperty(const Expression& expression) {
     return expression.constCast<PropertyExpression>().isSingleLabel();
 }
 
-static std::optional<cardinality_t> getTableStatsIfPossible(main::ClientContext* context,
-    const Expression& predicate,
+static const storage::ColumnStats* getColumnStatsIfPossible(main::ClientContext* context,
+    const Expression& expression,
     const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
-    KU_ASSERT(predicate.getNumChildren() >= 1);
-    if (isSingleLabelledProperty(*predicate.getChild(0))) {
-        auto& propertyExpr = predicate.getChild(0)->cast<PropertyExpression>();
+    if (isSingleLabelledProperty(expression)) {
+        auto& propertyExpr = expression.constCast<PropertyExpression>();
         auto tableID = propertyExpr.getSingleTableID();
         if (nodeTableStats.contains(tableID) && propertyExpr.hasProperty(tableID)) {
             auto entry =
                 context->getCatalog()->getTableCatalogEntry(context->getTransaction(), tableID);
             auto columnID = entry->getColumnID(propertyExpr.getPropertyName());
             if (columnID != INVALID_COLUMN_ID && columnID != ROW_IDX_COLUMN_ID) {
-                auto& stats = nodeTableStats.at(tableID);
-                return atLeastOne(stats.getNumDistinctValues(columnID));
+                return &nodeTableStats.at(tableID).getColumnStats(columnID);
             }
         }
     }
+    return nullptr;
+}
+
+static std::optional<cardinality_t> getTableStatsIfPossible(main::ClientContext* context,
+    const Expression& predicate,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    KU_ASSERT(predicate.getNumChildren() >= 1);
+    const auto columnStats =
+        getColumnStatsIfPossible(context, *predicate.getChild(0), nodeTableStats);
+    if (columnStats != nullptr) {
+        return atLeastOne(columnStats->getNumDistinctValues());
+    }
     return {};
 }
 
+// Returns the value of a literal compared against a property of the same type.
+static std::optional<double> getComparedValue(const Expression& property,
+    const Expression& literal) {
+    if (literal.expressionType != ExpressionType::LITERAL ||
+        literal.getDataType() != property.getDataType()) {
+        return std::nullopt;
+    }
+    return storage::ColumnSample::getSampleValue(literal.constCast<LiteralExpression>().value);
+}
+
+static ExpressionType flipComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
+    }
+}
+
+// Estimates the selectivity of comparisons and IN predicates between a property and literals
+// from the histogram of the property's column.
+static std::optional<double> estimateSelectivityFromHistogram(main::ClientContext* context,
+    const Expression& predicate,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    std::shared_ptr<Expression> property, literal;
+    auto comparisonType = predicate.expressionType;
+    if (ExpressionTypeUtil::isComparison(comparisonType)) {
+        property = predicate.getChild(0);
+        literal = predicate.getChild(1);
+        if (property->expressionType != ExpressionType::PROPERTY) {
+            std::swap(property, literal);
+            comparisonType = flipComparison(comparisonType);
+        }
+    } else if (predicate.expressionType == ExpressionType::FUNCTION &&
+               predicate.constCast<ScalarFunctionExpression>().getFunction().name ==
+                   function::ListContainsFunction::name) {
+        // x IN [...] is bound as LIST_CONTAINS([...], x).
+        literal = predicate.getChild(0);
+        property = predicate.getChild(1);
+    } else {
+        return std::nullopt;
+    }
+    const auto columnStats = getColumnStatsIfPossible(context, *property, nodeTableStats);
+    if (columnStats == nullptr) {
+        return std::nullopt;
+    }
+    const auto histogram = columnStats->getHistogram();
+    if (!histogram) {
+        return std::nullopt;
+    }
+    const auto numDistinctValues = columnStats->getNumDistinctValues();
+    if (predicate.expressionType == ExpressionType::FUNCTION) {
+        if (literal->expressionType != ExpressionType::LITERAL ||
+            ListType::getChildType(literal->getDataType()) != property->getDataType()) {
+            return std::nullopt;
+        }
+        const auto& list = literal->constCast<LiteralExpression>().value;
+        std::vector<double> values;
+        for (auto i = 0u; i < list.getChildrenSize(); i++) {
+            const auto value =
+                storage::ColumnSample::getSampleValue(*NestedVal::getChildVal(&list, i));
+            if (value.has_value()) {
+                values.push_back(*value);
+            }
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        double selectivity = 0;
+        for (const auto value : values) {
+            selectivity += histogram->estimateEqualitySelectivity(value, numDistinctValues);
+        }
+        return std::min(1.0, selectivity);
+    }
+    const auto value = getComparedValue(*property, *literal);
+    if (!value.has_value()) {
+        return std::nullopt;
+    }
+    switch (comparisonType) {
+    case ExpressionType::EQUALS:
+        return histogram->estimateEqualitySelectivity(*value, numDistinctValues);
+    case ExpressionType::NOT_EQUALS:
+        return 1 - histogram->estimateEqualitySelectivity(*value, numDistinctValues);
+    case ExpressionType::GREATER_THAN:
+        return histogram->estimateRangeSelectivity(value, false, std::nullopt, false);
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return histogram->estimateRangeSelectivity(value, true, std::nullopt, false);
+    case ExpressionType::LESS_THAN:
+        return histogram->estimateRangeSelectivity(std::nullopt, false, value, false);
+    case ExpressionType::LESS_THAN_EQUALS:
+        return histogram->estimateRangeSelectivity(std::nullopt, false, value, true);
+    default:
+        return std::nullopt;
+    }
+}
+
 uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
     const Expression& predicate) const {
+    if (predicate.expressionType == ExpressionType::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)))) {
+        return 1;
+    }
+    const auto selectivity =
+        estimateSelectivityFromHistogram(context, predicate, nodeTableStats);
+    if (selectivity.has_value()) {
+        return atLeastOne(childPlan.getCardinality() * selectivity.value());
+    }
     if (predicate.expressionType == ExpressionType::EQUALS) {
-        if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
-            return 1;
-        } else {
-            const auto numDistinctValues =
-                getTableStatsIfPossible(context, predicate, nodeTableStats);
-            if (numDistinctValues.has_value()) {
-                return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
-            }
-            return atLeastOne(
-                childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
+        const auto numDistinctValues = getTableStatsIfPossible(context, predicate, nodeTableStats);
+        if (numDistinctValues.has_value()) {
+            return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
         }
+        return atLeastOne(
+            childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
     } else {
         return atLeastOne(
             childPlan.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
@@ -22,7 +22,8 @@ void LogicalScanNodeTable::computeFactorizedSchema() {
         schema->insertToGroupAndScope(property, groupPos);
     }
     switch (scanType) {
-    case LogicalScanNodeTableType::PRIMARY_KEY_SCAN: {
+    case LogicalScanNodeTableType::PRIMARY_KEY_SCAN:
+    case LogicalScanNodeTableType::INDEX_SCAN: {
         schema->setGroupAsSingleState(groupPos);
     } break;
     default:
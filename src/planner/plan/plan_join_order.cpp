@@ -153,7 +153,8 @@ LogicalPlan Planner::planQueryGraph(const QueryGraph& queryGraph,
 
 void Planner::planLevel(uint32_t level) {
     KU_ASSERT(level > 1);
-    if (level > MAX_LEVEL_TO_PLAN_EXACTLY) {
+    if (level > MAX_LEVEL_TO_PLAN_EXACTLY ||
+        context.subPlansTable->getNumEnumeratedPlans() > MAX_NUM_PLANS_TO_ENUMERATE_EXACTLY) {
         planLevelApproximately(level);
     } else {
         planLevelExactly(level);
@@ -171,7 +172,15 @@ void Planner::planLevelExactly(uint32_t level) {
     }
 }
 
+// Extend large subgraphs either with a binary join on a single variable or by closing a cycle
+// with a worst case optimal join. The latter only enumerates the intersect
+// candidates of each subgraph, so it is cheap enough to keep for large cyclic patterns, and plans
+// from both joins compete on cost.
 void Planner::planLevelApproximately(uint32_t level) {
+    auto maxLeftLevel = floor(level / 2.0);
+    for (auto leftLevel = 2u; leftLevel <= maxLeftLevel; ++leftLevel) {
+        planWCOJoin(leftLevel, level - leftLevel);
+    }
     planInnerJoin(1, level - 1);
 }
 
@@ -41,6 +41,14 @@ void SubgraphPlans::addPlan(LogicalPlan plan) {
     }
 }
 
+uint64_t SubgraphPlans::getMinCost() const {
+    auto minCost = UINT64_MAX;
+    for (auto& plan : plans) {
+        minCost = std::min(minCost, plan.getCost());
+    }
+    return minCost;
+}
+
 std::bitset<MAX_NUM_QUERY_VARIABLES> SubgraphPlans::encodePlan(const LogicalPlan& plan) {
     auto schema = plan.getSchema();
     std::bitset<MAX_NUM_QUERY_VARIABLES> result;
@@ -60,15 +68,32 @@ std::vector<SubqueryGraph> DPLevel::getSubqueryGraphs() {
 }
 
 void DPLevel::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan) {
-    if (subgraph2Plans.size() > MAX_NUM_SUBGRAPH) {
-        return;
-    }
     if (!contains(subqueryGraph)) {
+        if (subgraph2Plans.size() > MAX_NUM_SUBGRAPH && !tryEvictSubgraph(plan.getCost())) {
+            return;
+        }
         subgraph2Plans.insert({subqueryGraph, SubgraphPlans(subqueryGraph)});
     }
     subgraph2Plans.at(subqueryGraph).addPlan(std::move(plan));
 }
 
+bool DPLevel::tryEvictSubgraph(uint64_t cost) {
+    auto maxMinCost = cost;
+    auto subgraphToEvict = subgraph2Plans.end();
+    for (auto it = subgraph2Plans.begin(); it != subgraph2Plans.end(); ++it) {
+        auto minCost = it->second.getMinCost();
+        if (minCost > maxMinCost) {
+            maxMinCost = minCost;
+            subgraphToEvict = it;
+        }
+    }
+    if (subgraphToEvict == subgraph2Plans.end()) {
+        return false;
+    }
+    subgraph2Plans.erase(subgraphToEvict);
+    return true;
+}
+
 void SubPlansTable::resize(uint32_t newSize) {
     auto prevSize = dpLevels.size();
     dpLevels.resize(newSize);
@@ -99,11 +124,13 @@ std::vector<SubqueryGraph> SubPlansTable::getSubqueryGraphs(uint32_t level) {
 }
 
 void SubPlansTable::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan) {
+    numEnumeratedPlans++;
     auto& dpLevel = getDPLevelUnsafe(subqueryGraph);
     dpLevel.addPlan(subqueryGraph, std::move(plan));
 }
 
 void SubPlansTable::clear() {
+    numEnumeratedPlans = 0;
     for (auto& dpLevel : dpLevels) {
         dpLevel.clear();
     }
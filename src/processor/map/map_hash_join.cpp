@@ -4,6 +4,9 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
 #include "processor/plan_mapper.h"
+#include "processor/result/factorized_table_util.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::planner;
@@ -87,6 +90,18 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
     auto globalHashTable = std::make_unique<JoinHashTable>(*clientContext->getMemoryManager(),
         LogicalType::copy(buildKeyTypes), buildInfo.tableSchema.copy());
     auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    // Spilled build side partitions are joined after the probe side by replaying buffered probe
+    // tuples one at a time, which requires a flat probe. Unflat columns are kept in memory, so
+    // spilling them wouldn't help.
+    auto canSpill = hashJoin->requireFlatProbeKeys() &&
+                    buildInfo.tableSchema.getNumUnFlatColumns() == 0;
+    if (canSpill) {
+        auto bm = clientContext->getMemoryManager()->getBufferManager();
+        bm->getSpillerOrSkip([&](storage::Spiller& spiller) {
+            sharedState->enableSpilling(&spiller,
+                bm->getMemoryLimit() * HashJoinSharedState::SPILL_MEMORY_RATIO);
+        });
+    }
     auto buildPrintInfo = std::make_unique<HashJoinBuildPrintInfo>(buildKeys, payloads);
     auto hashJoinBuild = std::make_unique<HashJoinBuild>(PhysicalOperatorType::HASH_JOIN_BUILD,
         sharedState, std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(),
@@ -102,6 +117,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
         probePayloadsOutPos.emplace_back(outSchema->getExpressionPos(*payload));
     }
     ProbeDataInfo probeDataInfo(probeKeysDataPos, probePayloadsOutPos);
+    if (sharedState->isSpillingEnabled()) {
+        auto probeSideExprs = hashJoin->getChild(0)->getSchema()->getExpressionsInScope();
+        for (auto& expr : probeSideExprs) {
+            probeDataInfo.probeSideDataPos.emplace_back(outSchema->getExpressionPos(*expr));
+        }
+        probeDataInfo.probeSideTableSchema =
+            FactorizedTableUtils::createFTableSchema(probeSideExprs, *outSchema);
+        // Multiplicity of the result set.
+        probeDataInfo.probeSideTableSchema.appendColumn(ColumnSchema(false /* isUnFlat */,
+            INVALID_DATA_CHUNK_POS, LogicalTypeUtils::getRowLayoutSize(LogicalType::INT64())));
+    }
     if (hashJoin->hasMark()) {
         auto mark = hashJoin->getMark();
         auto markOutputPos = DataPos(outSchema->getExpressionPos(*mark));
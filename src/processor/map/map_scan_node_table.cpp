@@ -4,6 +4,7 @@
 #include "common/mask.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "processor/expression_mapper.h"
+#include "processor/operator/scan/index_scan_node_table.h"
 #include "processor/operator/scan/primary_key_scan_node_table.h"
 #include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
@@ -85,6 +86,32 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
         return std::make_unique<PrimaryKeyScanNodeTable>(std::move(scanInfo), std::move(tableInfos),
             std::move(evaluator), std::move(sharedState), getOperatorID(), std::move(printInfo));
     }
+    case LogicalScanNodeTableType::INDEX_SCAN: {
+        KU_ASSERT(tableInfos.size() == 1);
+        auto& indexScanInfo = scan.getExtraInfo()->constCast<IndexScanInfo>();
+        auto exprMapper = ExpressionMapper(outSchema);
+        auto lowerBound = IndexScanBound();
+        auto upperBound = IndexScanBound();
+        std::string range;
+        if (indexScanInfo.lowerBound != nullptr) {
+            lowerBound = IndexScanBound(exprMapper.getEvaluator(indexScanInfo.lowerBound),
+                indexScanInfo.lowerInclusive);
+            range += indexScanInfo.lowerBound->toString();
+            range += indexScanInfo.lowerInclusive ? "<=" : "<";
+        }
+        range += indexScanInfo.property->toString();
+        if (indexScanInfo.upperBound != nullptr) {
+            upperBound = IndexScanBound(exprMapper.getEvaluator(indexScanInfo.upperBound),
+                indexScanInfo.upperInclusive);
+            range += indexScanInfo.upperInclusive ? "<=" : "<";
+            range += indexScanInfo.upperBound->toString();
+        }
+        auto printInfo = std::make_unique<IndexScanPrintInfo>(scan.getProperties(),
+            indexScanInfo.indexName, std::move(range), alias);
+        return std::make_unique<IndexScanNodeTable>(std::move(scanInfo), std::move(tableInfos[0]),
+            indexScanInfo.indexName, std::move(lowerBound), std::move(upperBound), getOperatorID(),
+            std::move(printInfo));
+    }
     default:
         KU_UNREACHABLE;
     }
@@ -2,6 +2,9 @@
 
 #include "main/client_context.h"
 #include "processor/operator/aggregate/aggregate_hash_table.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::function;
 
@@ -38,12 +41,18 @@ void BaseAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
 }
 
 BaseAggregateSharedState::HashTableQueue::HashTableQueue(storage::MemoryManager* memoryManager,
-    FactorizedTableSchema tableSchema) {
+    FactorizedTableSchema tableSchema)
+    : spiller{nullptr}, numBytesSpilled{0}, numBytesRead{0} {
     headBlock = new TupleBlock(memoryManager, std::move(tableSchema));
     numTuplesPerBlock = headBlock.load()->table.getNumTuplesPerBlock();
+    memoryManager->getBufferManager()->getSpillerOrSkip(
+        [&](storage::Spiller& spiller) { this->spiller = &spiller; });
 }
 
 BaseAggregateSharedState::HashTableQueue::~HashTableQueue() {
+    if (numBytesSpilled > 0) {
+        spiller->unregisterOperatorState();
+    }
     delete headBlock.load();
     TupleBlock* block = nullptr;
     while (queuedTuples.pop(block)) {
@@ -58,7 +67,10 @@ void BaseAggregateSharedState::HashTableQueue::appendTuple(std::span<uint8_t> tu
         auto posToWrite = block->numTuplesReserved++;
         if (posToWrite < numTuplesPerBlock) {
             memcpy(block->table.getTuple(posToWrite), tuple.data(), tuple.size());
-            block->numTuplesWritten++;
+            if (++block->numTuplesWritten == numTuplesPerBlock) {
+                // This was the last write to the block, so nothing else accesses it until merging.
+                spillIfNecessary(*block);
+            }
             return;
         } else {
             // No more space in the block, allocate and replace it
@@ -78,6 +90,21 @@ void BaseAggregateSharedState::HashTableQueue::appendTuple(std::span<uint8_t> tu
     }
 }
 
+void BaseAggregateSharedState::HashTableQueue::spillIfNecessary(TupleBlock& block) {
+    if (spiller == nullptr) {
+        return;
+    }
+    auto bm = block.table.getMemoryManager()->getBufferManager();
+    if (bm->getUsedMemory() < bm->getMemoryLimit() * SPILL_MEMORY_RATIO) {
+        return;
+    }
+    auto numBytes = block.table.spillFlatTupleBlocks(*spiller, false /* keepLastBlock */);
+    if (numBytes > 0 && numBytesSpilled.fetch_add(numBytes) == 0) {
+        // Keeps the spill file from being truncated before the blocks are read back.
+        spiller->registerOperatorState();
+    }
+}
+
 void BaseAggregateSharedState::HashTableQueue::mergeInto(AggregateHashTable& hashTable) {
     TupleBlock* partitionToMerge = nullptr;
     auto headBlock = this->headBlock.load();
@@ -85,10 +112,16 @@ void BaseAggregateSharedState::HashTableQueue::mergeInto(AggregateHashTable& has
     while (queuedTuples.pop(partitionToMerge)) {
         KU_ASSERT(
             partitionToMerge->numTuplesWritten == partitionToMerge->table.getNumTuplesPerBlock());
+        if (spiller != nullptr) {
+            numBytesRead += partitionToMerge->table.loadFlatTupleBlocks(*spiller);
+        }
         hashTable.merge(std::move(partitionToMerge->table));
         delete partitionToMerge;
     }
     if (headBlock->numTuplesWritten > 0) {
+        if (spiller != nullptr) {
+            numBytesRead += headBlock->table.loadFlatTupleBlocks(*spiller);
+        }
         headBlock->table.resize(headBlock->numTuplesWritten);
         hashTable.merge(std::move(headBlock->table));
     }
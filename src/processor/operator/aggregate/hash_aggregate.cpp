@@ -141,6 +141,32 @@ uint64_t HashAggregateSharedState::getNumTuples() const {
     return numTuples;
 }
 
+uint64_t HashAggregateSharedState::getNumBytesSpilled() const {
+    uint64_t numBytes = 0;
+    for (auto& partition : globalPartitions) {
+        numBytes += partition.queue->getNumBytesSpilled();
+        for (auto& queue : partition.distinctTableQueues) {
+            if (queue) {
+                numBytes += queue->getNumBytesSpilled();
+            }
+        }
+    }
+    return numBytes;
+}
+
+uint64_t HashAggregateSharedState::getNumBytesRead() const {
+    uint64_t numBytes = 0;
+    for (auto& partition : globalPartitions) {
+        numBytes += partition.queue->getNumBytesRead();
+        for (auto& queue : partition.distinctTableQueues) {
+            if (queue) {
+                numBytes += queue->getNumBytesRead();
+            }
+        }
+    }
+    return numBytes;
+}
+
 void HashAggregateSharedState::finalizePartitions() {
     BaseAggregateSharedState::finalizePartitions(globalPartitions, [&](auto& partition) {
         if (!partition.hashTable) {
@@ -260,5 +286,17 @@ void HashAggregate::executeInternal(ExecutionContext* context) {
     localState.aggregateHashTable->mergeIfFull(0 /*tuplesToAdd*/, true /*mergeAll*/);
 }
 
+std::unordered_map<std::string, std::string> HashAggregate::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = BaseAggregate::getProfilerKeyValAttributes(profiler);
+    auto& hashAggSharedState = getSharedStateReference();
+    auto numBytesSpilled = hashAggSharedState.getNumBytesSpilled();
+    if (numBytesSpilled > 0) {
+        result.insert({"BytesSpilled", std::to_string(numBytesSpilled)});
+        result.insert({"BytesReadFromDisk", std::to_string(hashAggSharedState.getNumBytesRead())});
+    }
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include "binder/expression/expression_util.h"
 #include "processor/execution_context.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -19,9 +20,108 @@ std::string HashJoinBuildPrintInfo::toString() const {
     return result;
 }
 
+HashJoinSharedState::~HashJoinSharedState() {
+    if (numSpilledPartitions > 0) {
+        spiller->unregisterOperatorState();
+    }
+}
+
 void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
     std::unique_lock lck(mtx);
-    hashTable->merge(localHashTable);
+    if (partitions.empty()) {
+        hashTable->merge(localHashTable);
+        // Partitioning copies the tuples before the global table is cleared, so it has to start
+        // while the tuples take up at most half of the budget.
+        if (!isSpillingEnabled() || hashTable->getResidentMemoryUsage() <= memoryBudget / 2) {
+            return;
+        }
+        partitionGlobalHashTable();
+    } else {
+        localHashTable.partitionInto(getPartitionTables(), SHIFT_FOR_PARTITIONING);
+    }
+    spillPartitionsIfNecessary();
+}
+
+std::vector<JoinHashTable*> HashJoinSharedState::getPartitionTables() const {
+    std::vector<JoinHashTable*> tables;
+    tables.reserve(partitions.size());
+    for (auto& partition : partitions) {
+        tables.push_back(partition->hashTable.get());
+    }
+    return tables;
+}
+
+void HashJoinSharedState::partitionGlobalHashTable() {
+    KU_ASSERT(partitions.empty());
+    partitions.reserve(NUM_PARTITIONS);
+    for (auto i = 0u; i < NUM_PARTITIONS; i++) {
+        partitions.push_back(std::make_unique<Partition>(hashTable->createEmptyTable()));
+    }
+    hashTable->partitionInto(getPartitionTables(), SHIFT_FOR_PARTITIONING);
+}
+
+void HashJoinSharedState::spillPartitionsIfNecessary() {
+    uint64_t memoryUsage = 0;
+    for (auto& partition : partitions) {
+        if (partition->spilled) {
+            // Tuples of spilled partitions are only kept in memory until their block is full.
+            numBytesSpilled +=
+                partition->hashTable->spillToDisk(*spiller, true /* keepLastBlock */);
+        }
+        memoryUsage += partition->hashTable->getResidentMemoryUsage();
+    }
+    while (memoryUsage > memoryBudget) {
+        Partition* partitionToSpill = nullptr;
+        for (auto& partition : partitions) {
+            if (!partition->spilled &&
+                (partitionToSpill == nullptr ||
+                    partition->hashTable->getResidentMemoryUsage() >
+                        partitionToSpill->hashTable->getResidentMemoryUsage())) {
+                partitionToSpill = partition.get();
+            }
+        }
+        if (partitionToSpill == nullptr) {
+            break;
+        }
+        if (numSpilledPartitions++ == 0) {
+            spiller->registerOperatorState();
+        }
+        partitionToSpill->spilled = true;
+        auto numBytes =
+            partitionToSpill->hashTable->spillToDisk(*spiller, true /* keepLastBlock */);
+        numBytesSpilled += numBytes;
+        memoryUsage -= numBytes;
+    }
+}
+
+void HashJoinSharedState::finalizePartitions() {
+    for (auto& partition : partitions) {
+        if (partition->spilled) {
+            numBytesSpilled +=
+                partition->hashTable->spillToDisk(*spiller, false /* keepLastBlock */);
+        } else {
+            hashTable->merge(*partition->hashTable);
+        }
+    }
+}
+
+JoinHashTable* HashJoinSharedState::acquireSpilledPartition(idx_t partitionIdx) {
+    auto& partition = *partitions[partitionIdx];
+    KU_ASSERT(partition.spilled);
+    std::unique_lock lck{partition.mtx};
+    if (partition.numProbers++ == 0) {
+        partition.hashTable->loadFromDisk(*spiller);
+    }
+    return partition.hashTable.get();
+}
+
+void HashJoinSharedState::releaseSpilledPartition(idx_t partitionIdx) {
+    auto& partition = *partitions[partitionIdx];
+    std::unique_lock lck{partition.mtx};
+    KU_ASSERT(partition.numProbers > 0);
+    if (--partition.numProbers == 0) {
+        partition.hashTable->unloadToDisk(*spiller);
+    }
 }
 
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
@@ -53,6 +153,7 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
 }
 
 void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
+    sharedState->finalizePartitions();
     auto numTuples = sharedState->getHashTable()->getNumEntries();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
@@ -66,10 +167,28 @@ void HashJoinBuild::executeInternal(ExecutionContext* context) {
             numAppended += appendVectors();
         }
         metrics->numOutputTuple.increase(numAppended);
+        // With spilling enabled, local tuples are handed over to the shared state early so that
+        // it can keep the total memory usage within its budget.
+        if (sharedState->isSpillingEnabled() &&
+            hashTable->getFactorizedTable()->getNumFlatTupleBlocks() >=
+                HashJoinSharedState::NUM_LOCAL_BLOCKS_TO_MERGE) {
+            sharedState->mergeLocalHashTable(*hashTable);
+            hashTable->clear();
+        }
     }
     // Merge with global hash table once local tuples are all appended.
     sharedState->mergeLocalHashTable(*hashTable);
 }
 
+std::unordered_map<std::string, std::string> HashJoinBuild::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = Sink::getProfilerKeyValAttributes(profiler);
+    auto numBytesSpilled = sharedState->getNumBytesSpilled();
+    if (numBytesSpilled > 0) {
+        result.insert({"BytesSpilled", std::to_string(numBytesSpilled)});
+    }
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
@@ -40,6 +40,124 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
         tmpHashVector = std::make_unique<ValueVector>(LogicalType::HASH(),
             context->clientContext->getMemoryManager());
     }
+    hashTable = sharedState->getHashTable();
+    if (sharedState->hasSpilledPartitions()) {
+        KU_ASSERT(flatProbe && !probeDataInfo.probeSideDataPos.empty());
+        spilledProbeState = std::make_unique<SpilledProbeState>();
+        spilledProbeState->memoryManager = context->clientContext->getMemoryManager();
+        spilledProbeState->partitions.resize(HashJoinSharedState::NUM_PARTITIONS);
+        for (auto& dataPos : probeDataInfo.probeSideDataPos) {
+            auto vector = resultSet->getValueVector(dataPos).get();
+            spilledProbeState->vectors.push_back(vector);
+            if (std::find(spilledProbeState->states.begin(), spilledProbeState->states.end(),
+                    vector->state.get()) == spilledProbeState->states.end()) {
+                spilledProbeState->states.push_back(vector->state.get());
+            }
+        }
+        spilledProbeState->multiplicityVector = std::make_unique<ValueVector>(LogicalType::INT64(),
+            context->clientContext->getMemoryManager());
+        spilledProbeState->multiplicityVector->state =
+            DataChunkState::getSingleValueDataChunkState();
+        spilledProbeState->vectors.push_back(spilledProbeState->multiplicityVector.get());
+        spilledProbeState->colIdxes.resize(spilledProbeState->vectors.size());
+        iota(spilledProbeState->colIdxes.begin(), spilledProbeState->colIdxes.end(), 0);
+    }
+}
+
+bool HashJoinProbe::getNextProbeTuple(ExecutionContext* context) {
+    if (spilledProbeState == nullptr) {
+        return children[0]->getNextTuple(context);
+    }
+    auto spiller = sharedState->getSpiller();
+    while (!spilledProbeState->probeSideExhausted) {
+        if (!children[0]->getNextTuple(context)) {
+            spilledProbeState->probeSideExhausted = true;
+            for (auto& table : spilledProbeState->partitions) {
+                if (table != nullptr) {
+                    table->spillFlatTupleBlocks(*spiller, false /* keepLastBlock */);
+                }
+            }
+            break;
+        }
+        auto partitionIdx = getSpilledPartitionIdx();
+        if (partitionIdx == INVALID_IDX) {
+            return true;
+        }
+        bufferProbeTuple(partitionIdx);
+    }
+    return scanBufferedProbeTuple();
+}
+
+idx_t HashJoinProbe::getSpilledPartitionIdx() {
+    for (auto& keyVector : keyVectors) {
+        // Null keys never match, so they are handled together with the resident partitions.
+        if (keyVector->isNull(keyVector->state->getSelVector()[0])) {
+            return INVALID_IDX;
+        }
+    }
+    hashTable->computeProbeHashes(keyVectors, *hashVector, hashSelVec, tmpHashVector.get());
+    auto partitionIdx = sharedState->getPartitionIdx(hashVector->getValue<hash_t>(hashSelVec[0]));
+    return sharedState->isPartitionSpilled(partitionIdx) ? partitionIdx : INVALID_IDX;
+}
+
+void HashJoinProbe::bufferProbeTuple(idx_t partitionIdx) {
+    auto& table = spilledProbeState->partitions[partitionIdx];
+    if (table == nullptr) {
+        table = std::make_unique<FactorizedTable>(spilledProbeState->memoryManager,
+            probeDataInfo.probeSideTableSchema.copy());
+    }
+    spilledProbeState->multiplicityVector->setValue<int64_t>(0, resultSet->multiplicity);
+    table->append(spilledProbeState->vectors);
+    if (table->getNumFlatTupleBlocks() > 1) {
+        table->spillFlatTupleBlocks(*sharedState->getSpiller(), true /* keepLastBlock */);
+    }
+}
+
+bool HashJoinProbe::scanBufferedProbeTuple() {
+    auto& state = *spilledProbeState;
+    auto spiller = sharedState->getSpiller();
+    while (true) {
+        if (state.partitionIdx != INVALID_IDX) {
+            auto& table = *state.partitions[state.partitionIdx];
+            if (state.nextTupleIdx < table.getNumTuples()) {
+                auto& blocks = table.getTupleDataBlocks();
+                auto blockIdx = state.nextTupleIdx / table.getNumTuplesPerBlock();
+                if (state.nextTupleIdx % table.getNumTuplesPerBlock() == 0) {
+                    if (blockIdx > 0) {
+                        blocks[blockIdx - 1]->unloadToDisk(*spiller);
+                    }
+                    blocks[blockIdx]->loadFromDisk(*spiller);
+                }
+                for (auto chunkState : state.states) {
+                    if (chunkState->isFlat()) {
+                        chunkState->getSelVectorUnsafe().setToUnfiltered(1);
+                    } else {
+                        // The size is set when scanning the unflat column.
+                        chunkState->getSelVectorUnsafe().setToUnfiltered();
+                    }
+                }
+                table.scan(state.vectors, state.nextTupleIdx++, 1 /* numTuplesToScan */,
+                    state.colIdxes);
+                resultSet->multiplicity = state.multiplicityVector->getValue<int64_t>(0);
+                return true;
+            }
+            sharedState->releaseSpilledPartition(state.partitionIdx);
+            state.partitions[state.partitionIdx].reset();
+            hashTable = sharedState->getHashTable();
+        }
+        auto nextPartitionIdx = state.partitionIdx == INVALID_IDX ? 0 : state.partitionIdx + 1;
+        while (nextPartitionIdx < state.partitions.size() &&
+               state.partitions[nextPartitionIdx] == nullptr) {
+            nextPartitionIdx++;
+        }
+        if (nextPartitionIdx == state.partitions.size()) {
+            state.partitionIdx = INVALID_IDX;
+            return false;
+        }
+        state.partitionIdx = nextPartitionIdx;
+        state.nextTupleIdx = 0;
+        hashTable = sharedState->acquireSpilledPartition(state.partitionIdx);
+    }
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -52,14 +170,14 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         // which changes the selected position.
         // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
         restoreSelVector(*keyVectors[0]->state);
-        if (!children[0]->getNextTuple(context)) {
+        if (!getNextProbeTuple(context)) {
             return false;
         }
         saveSelVector(*keyVectors[0]->state);
-        sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
+        hashTable->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
             probeState->probedTuples.get());
     }
-    auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(keyVectors,
+    auto numMatchedTuples = hashTable->matchFlatKeys(keyVectors,
         probeState->probedTuples.get(), probeState->matchedTuples.get());
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
@@ -74,11 +192,10 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
         return false;
     }
     saveSelVector(*keyVector->state);
-    sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
+    hashTable->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
         probeState->probedTuples.get());
-    auto numMatchedTuples =
-        sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
-            probeState->matchedTuples.get(), probeState->matchedSelVector);
+    auto numMatchedTuples = hashTable->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
+        probeState->matchedTuples.get(), probeState->matchedSelVector);
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
     return true;
@@ -89,8 +206,8 @@ uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
         return 0;
     }
     auto numTuplesToRead = 1;
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
-        probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom, probeState->matchedTuples.get(),
+        probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
 }
@@ -109,8 +226,8 @@ uint64_t HashJoinProbe::getInnerJoinResultForUnFlatKey() {
         }
         keySelVector.setToFiltered(numTuplesToRead);
     }
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
-        probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom, probeState->matchedTuples.get(),
+        probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
 }
@@ -126,15 +126,39 @@ void JoinHashTable::buildHashSlots() {
     }
 }
 
-void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
-    SelectionVector& hashSelVec, ValueVector* tmpHashResultVector, uint8_t** probedTuples) {
-    KU_ASSERT(keyVectors.size() == keyTypes.size());
-    if (getNumEntries() == 0) {
-        return;
-    }
-    if (!discardNullFromKeys(keyVectors)) {
-        return;
-    }
+void JoinHashTable::loadFromDisk(const Spiller& spiller) {
+    factorizedTable->loadFlatTupleBlocks(spiller);
+    allocateHashSlots(getNumEntries());
+    buildHashSlots();
+}
+
+void JoinHashTable::unloadToDisk(const Spiller& spiller) {
+    // Prev pointers and hash slots are rebuilt on the next load, so they can be dropped.
+    hashSlotsBlocks.clear();
+    factorizedTable->unloadFlatTupleBlocks(spiller);
+}
+
+void JoinHashTable::partitionInto(const std::vector<JoinHashTable*>& partitions,
+    uint8_t shiftForPartitioning) {
+    auto numBytesPerTuple = getTableSchema()->getNumBytesPerTuple();
+    auto hashColOffset = getHashValueColOffset();
+    for (auto& partition : partitions) {
+        partition->factorizedTable->mergeMayContainNulls(*factorizedTable);
+    }
+    factorizedTable->forEach([&](const uint8_t* tuple) {
+        auto hash = *reinterpret_cast<const hash_t*>(tuple + hashColOffset);
+        auto partition = partitions[(hash >> shiftForPartitioning) % partitions.size()];
+        auto tupleToAppend = partition->factorizedTable->appendEmptyTuple();
+        memcpy(tupleToAppend, tuple, numBytesPerTuple);
+    });
+    // Tuples still point into the overflow buffer.
+    partitions[0]->factorizedTable->getInMemOverflowBuffer()->merge(
+        *factorizedTable->getInMemOverflowBuffer());
+    factorizedTable->clear();
+}
+
+void JoinHashTable::computeProbeHashes(const std::vector<ValueVector*>& keyVectors,
+    ValueVector& hashVector, SelectionVector& hashSelVec, ValueVector* tmpHashResultVector) const {
     hashSelVec.setSelSize(keyVectors[0]->state->getSelVector().getSelSize());
     function::VectorHashFunction::computeHash(*keyVectors[0], keyVectors[0]->state->getSelVector(),
         hashVector, hashSelVec);
@@ -145,6 +169,18 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
         function::VectorHashFunction::combineHash(hashVector, hashSelVec, *tmpHashResultVector,
             hashSelVec, hashVector, hashSelVec);
     }
+}
+
+void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
+    SelectionVector& hashSelVec, ValueVector* tmpHashResultVector, uint8_t** probedTuples) {
+    KU_ASSERT(keyVectors.size() == keyTypes.size());
+    if (getNumEntries() == 0) {
+        return;
+    }
+    if (!discardNullFromKeys(keyVectors)) {
+        return;
+    }
+    computeProbeHashes(keyVectors, hashVector, hashSelVec, tmpHashResultVector);
     for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
         KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
         probedTuples[i] = getTupleForHash(hashVector.getValue<hash_t>(hashSelVec[i]));
@@ -62,27 +62,71 @@ void Intersect::probeHTs() {
     }
 }
 
+// Node IDs are compared inline as intersecting is dominated by these comparisons.
+static bool isSmaller(const nodeID_t& left, const nodeID_t& right) {
+    return left.tableID < right.tableID ||
+           (left.tableID == right.tableID && left.offset < right.offset);
+}
+
+static bool isEqual(const nodeID_t& left, const nodeID_t& right) {
+    return left.offset == right.offset && left.tableID == right.tableID;
+}
+
+// Returns the position of the first node ID in [start, end) that is not smaller than `key`.
+// The range is first narrowed by doubling the step from `start` and then binary searched, so the
+// cost is logarithmic in the distance skipped instead of the length of the list.
+static sel_t gallop(const nodeID_t* nodeIDs, sel_t start, sel_t end, const nodeID_t& key) {
+    sel_t step = 1;
+    auto low = start;
+    auto high = start;
+    while (high < end && isSmaller(nodeIDs[high], key)) {
+        low = high + 1;
+        high = std::min<sel_t>(high + step, end);
+        step *= 2;
+    }
+    return std::lower_bound(nodeIDs + low, nodeIDs + high, key, isSmaller) - nodeIDs;
+}
+
 void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
     nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
     KU_ASSERT(lSelVector.getSelSize() <= rSelVector.getSelSize());
     auto leftPositionBuffer = lSelVector.getMutableBuffer();
     auto rightPositionBuffer = rSelVector.getMutableBuffer();
+    const auto numLeftNodeIDs = lSelVector.getSelSize();
+    const auto numRightNodeIDs = rSelVector.getSelSize();
     sel_t leftPosition = 0, rightPosition = 0;
     uint64_t outputValuePosition = 0;
-    while (leftPosition < lSelVector.getSelSize() && rightPosition < rSelVector.getSelSize()) {
-        auto leftNodeID = leftNodeIDs[leftPosition];
-        auto rightNodeID = rightNodeIDs[rightPosition];
-        if (leftNodeID < rightNodeID) {
-            leftPosition++;
-        } else if (leftNodeID > rightNodeID) {
-            rightPosition++;
-        } else {
-            leftPositionBuffer[outputValuePosition] = leftPosition;
-            rightPositionBuffer[outputValuePosition] = rightPosition;
-            leftNodeIDs[outputValuePosition] = leftNodeID;
+    const auto appendMatch = [&](const nodeID_t& nodeID) {
+        leftPositionBuffer[outputValuePosition] = leftPosition;
+        rightPositionBuffer[outputValuePosition] = rightPosition;
+        leftNodeIDs[outputValuePosition] = nodeID;
+        outputValuePosition++;
+    };
+    if (numRightNodeIDs > GALLOPING_THRESHOLD * numLeftNodeIDs) {
+        // Most of the right list won't match, so skip through it instead of scanning it.
+        while (leftPosition < numLeftNodeIDs && rightPosition < numRightNodeIDs) {
+            auto leftNodeID = leftNodeIDs[leftPosition];
+            rightPosition = gallop(rightNodeIDs, rightPosition, numRightNodeIDs, leftNodeID);
+            if (rightPosition < numRightNodeIDs &&
+                isEqual(leftNodeID, rightNodeIDs[rightPosition])) {
+                appendMatch(leftNodeID);
+                rightPosition++;
+            }
             leftPosition++;
-            rightPosition++;
-            outputValuePosition++;
+        }
+    } else {
+        while (leftPosition < numLeftNodeIDs && rightPosition < numRightNodeIDs) {
+            auto leftNodeID = leftNodeIDs[leftPosition];
+            auto rightNodeID = rightNodeIDs[rightPosition];
+            if (isSmaller(leftNodeID, rightNodeID)) {
+                leftPosition++;
+            } else if (isSmaller(rightNodeID, leftNodeID)) {
+                rightPosition++;
+            } else {
+                appendMatch(leftNodeID);
+                leftPosition++;
+                rightPosition++;
+            }
         }
     }
     lSelVector.setToFiltered(outputValuePosition);
@@ -100,20 +144,21 @@ static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
     return listsToIntersect;
 }
 
-static std::vector<uint32_t> swapSmallestListToFront(std::vector<overflow_value_t>& lists) {
+// Orders the lists from the smallest to the largest, so that the intermediate result, which is
+// bounded by the smallest list, is intersected against increasingly larger lists.
+static std::vector<uint32_t> sortListsBySize(std::vector<overflow_value_t>& lists) {
     KU_ASSERT(lists.size() >= 2);
     std::vector<uint32_t> listIdxes(lists.size());
     iota(listIdxes.begin(), listIdxes.end(), 0);
-    uint32_t smallestListIdx = 0;
-    for (auto i = 1u; i < lists.size(); i++) {
-        if (lists[i].numElements < lists[smallestListIdx].numElements) {
-            smallestListIdx = i;
-        }
-    }
-    if (smallestListIdx != 0) {
-        std::swap(lists[smallestListIdx], lists[0]);
-        std::swap(listIdxes[smallestListIdx], listIdxes[0]);
+    std::stable_sort(listIdxes.begin(), listIdxes.end(), [&](uint32_t a, uint32_t b) {
+        return lists[a].numElements < lists[b].numElements;
+    });
+    std::vector<overflow_value_t> sortedLists;
+    sortedLists.reserve(lists.size());
+    for (auto listIdx : listIdxes) {
+        sortedLists.push_back(lists[listIdx]);
     }
+    lists = std::move(sortedLists);
     return listIdxes;
 }
 
@@ -211,7 +256,7 @@ bool Intersect::getNextTuplesInternal(ExecutionContext* context) {
         }
         auto listsToIntersect =
             fetchListsToIntersectFromTuples(flatTuplesToIntersect, isIntersectListAFlatValue);
-        auto listIdxes = swapSmallestListToFront(listsToIntersect);
+        auto listIdxes = sortListsBySize(listsToIntersect);
         intersectLists(listsToIntersect);
         if (outKeyVector->state->getSelVector().getSelSize() != 0) {
             populatePayloads(flatTuplesToIntersect, listIdxes);
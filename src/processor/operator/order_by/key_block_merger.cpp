@@ -1,6 +1,9 @@
 #include "processor/operator/order_by/key_block_merger.h"
 
 #include "common/system_config.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::common;
 using namespace kuzu::processor;
@@ -40,6 +43,23 @@ uint8_t* MergedKeyBlocks::getBlockEndTuplePtr(uint32_t blockIdx, uint64_t endTup
                                           getKeyBlockBuffer(blockIdx) + endTupleOffset;
 }
 
+uint64_t MergedKeyBlocks::spillToDisk(const Spiller& spiller) const {
+    uint64_t numBytesSpilled = 0;
+    for (auto& keyBlock : keyBlocks) {
+        if (!keyBlock->isSpilled()) {
+            numBytesSpilled += keyBlock->getSizedData().size();
+            keyBlock->spillToDisk(spiller);
+        }
+    }
+    return numBytesSpilled;
+}
+
+void MergedKeyBlocks::loadFromDisk(const Spiller& spiller) const {
+    for (auto& keyBlock : keyBlocks) {
+        keyBlock->loadFromDisk(spiller);
+    }
+}
+
 BlockPtrInfo::BlockPtrInfo(uint64_t startTupleIdx, uint64_t endTupleIdx, MergedKeyBlocks* keyBlocks)
     : keyBlocks{keyBlocks}, curBlockIdx{startTupleIdx / keyBlocks->getNumTuplesPerBlock()},
       endBlockIdx{endTupleIdx == 0 ? 0 : (endTupleIdx - 1) / keyBlocks->getNumTuplesPerBlock()},
@@ -285,6 +305,10 @@ std::unique_ptr<KeyBlockMergeMorsel> KeyBlockMergeTaskDispatcher::getMorsel() {
         sortedKeyBlocks->pop();
         auto rightKeyBlock = sortedKeyBlocks->front();
         sortedKeyBlocks->pop();
+        if (hasSpilled) {
+            leftKeyBlock->loadFromDisk(*spiller);
+            rightKeyBlock->loadFromDisk(*spiller);
+        }
         auto resultKeyBlock = std::make_shared<MergedKeyBlocks>(leftKeyBlock->getNumBytesPerTuple(),
             leftKeyBlock->getNumTuples() + rightKeyBlock->getNumTuples(), memoryManager);
         auto newMergeTask = std::make_shared<KeyBlockMergeTask>(leftKeyBlock, rightKeyBlock,
@@ -308,6 +332,32 @@ void KeyBlockMergeTaskDispatcher::doneMorsel(std::unique_ptr<KeyBlockMergeMorsel
         !morsel->keyBlockMergeTask->hasMorselLeft()) {
         erase(activeKeyBlockMergeTasks, morsel->keyBlockMergeTask);
         sortedKeyBlocks->emplace(morsel->keyBlockMergeTask->resultKeyBlock);
+        // The last run is scanned right away, so it isn't worth spilling.
+        if (sortedKeyBlocks->size() > 1 || !activeKeyBlockMergeTasks.empty()) {
+            spillIfNecessary(*morsel->keyBlockMergeTask->resultKeyBlock);
+        }
+    }
+}
+
+void KeyBlockMergeTaskDispatcher::spillIfNecessary(const MergedKeyBlocks& keyBlocks) {
+    if (spiller == nullptr) {
+        return;
+    }
+    auto bm = memoryManager->getBufferManager();
+    if (bm->getUsedMemory() < bm->getMemoryLimit() * SPILL_MEMORY_RATIO) {
+        return;
+    }
+    if (!hasSpilled) {
+        // Keeps the spill file from being truncated before the runs are read back.
+        spiller->registerOperatorState();
+        hasSpilled = true;
+    }
+    numBytesSpilled += keyBlocks.spillToDisk(*spiller);
+}
+
+KeyBlockMergeTaskDispatcher::~KeyBlockMergeTaskDispatcher() {
+    if (hasSpilled) {
+        spiller->unregisterOperatorState();
     }
 }
 
@@ -320,6 +370,20 @@ void KeyBlockMergeTaskDispatcher::init(MemoryManager* memoryManager,
     this->sortedKeyBlocks = sortedKeyBlocks;
     this->keyBlockMerger = std::make_unique<KeyBlockMerger>(std::move(factorizedTables),
         strKeyColsInfo, numBytesPerTuple);
+    memoryManager->getBufferManager()->getSpillerOrSkip(
+        [&](Spiller& spiller) { this->spiller = &spiller; });
+    // The first two runs are merged right away. The remaining ones wait until an earlier merge
+    // has finished, which may take a while if there are many runs.
+    std::lock_guard<std::mutex> keyBlockMergeDispatcherLock{mtx};
+    auto numRuns = sortedKeyBlocks->size();
+    for (auto i = 0u; i < numRuns; i++) {
+        auto run = std::move(sortedKeyBlocks->front());
+        sortedKeyBlocks->pop();
+        if (i >= 2) {
+            spillIfNecessary(*run);
+        }
+        sortedKeyBlocks->push(std::move(run));
+    }
 }
 
 } // namespace processor
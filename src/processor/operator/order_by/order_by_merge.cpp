@@ -37,5 +37,15 @@ void OrderByMerge::initGlobalStateInternal(ExecutionContext* context) {
         sharedState->getStrKeyColInfo(), sharedState->getNumBytesPerTuple());
 }
 
+std::unordered_map<std::string, std::string> OrderByMerge::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = Sink::getProfilerKeyValAttributes(profiler);
+    auto numBytesSpilled = sharedDispatcher->getNumBytesSpilled();
+    if (numBytesSpilled > 0) {
+        result.insert({"BytesSpilled", std::to_string(numBytesSpilled)});
+    }
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
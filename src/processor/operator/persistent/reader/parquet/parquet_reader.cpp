@@ -12,6 +12,8 @@
 #include "processor/operator/persistent/reader/parquet/struct_column_reader.h"
 #include "processor/operator/persistent/reader/parquet/thrift_tools.h"
 #include "processor/operator/persistent/reader/reader_bind_utils.h"
+#include "storage/predicate/constant_predicate.h"
+#include "storage/table/column_chunk_stats.h"
 
 using namespace kuzu_parquet::format;
 
@@ -25,6 +27,7 @@ ParquetReader::ParquetReader(std::string filePath, std::vector<bool> columnSkips
     main::ClientContext* context)
     : filePath{std::move(filePath)}, columnSkips(std::move(columnSkips)), context{context} {
     initMetadata();
+    initColumnStatsInfos();
 }
 
 void ParquetReader::initializeScan(ParquetReaderScanState& state,
@@ -215,6 +218,143 @@ void ParquetReader::initMetadata() {
     metadata->read(proto.get());
 }
 
+// Skips the schema subtree rooted at schemaIdx and returns the number of column chunks in it.
+static uint64_t skipSchemaSubtree(const std::vector<SchemaElement>& schema, uint64_t& schemaIdx) {
+    KU_ASSERT(schemaIdx < schema.size());
+    auto& sEle = schema[schemaIdx++];
+    if (!sEle.__isset.num_children || sEle.num_children == 0) {
+        return 1;
+    }
+    uint64_t numChunks = 0;
+    for (auto i = 0; i < sEle.num_children; i++) {
+        numChunks += skipSchemaSubtree(schema, schemaIdx);
+    }
+    return numChunks;
+}
+
+void ParquetReader::initColumnStatsInfos() {
+    auto& schema = metadata->schema;
+    if (schema.empty()) {
+        return;
+    }
+    uint64_t schemaIdx = 1;
+    uint64_t chunkIdx = 0;
+    for (auto i = 0; i < schema[0].num_children; i++) {
+        auto& sEle = schema[schemaIdx];
+        auto info = ColumnStatsInfo{INVALID_IDX, LogicalTypeID::ANY};
+        auto isLeaf = !sEle.__isset.num_children || sEle.num_children == 0;
+        auto isRepeated = sEle.__isset.repetition_type &&
+                          sEle.repetition_type == FieldRepetitionType::REPEATED;
+        // Only integer statistics are used. Floating point statistics leave out NaNs.
+        if (isLeaf && !isRepeated && sEle.__isset.type &&
+            (sEle.type == Type::INT32 || sEle.type == Type::INT64)) {
+            auto typeID = deriveLogicalType(sEle).getLogicalTypeID();
+            if (LogicalTypeUtils::isIntegral(typeID)) {
+                info = ColumnStatsInfo{static_cast<idx_t>(chunkIdx), typeID};
+            }
+        }
+        columnStatsInfos.push_back(info);
+        chunkIdx += skipSchemaSubtree(schema, schemaIdx);
+    }
+}
+
+template<typename PARQUET_T, typename T>
+static std::optional<storage::StorageValue> decodeStatsValue(const std::string& encoded) {
+    if (encoded.size() != sizeof(PARQUET_T)) {
+        return std::nullopt;
+    }
+    PARQUET_T value{};
+    memcpy(&value, encoded.data(), sizeof(PARQUET_T));
+    return storage::StorageValue{static_cast<T>(value)};
+}
+
+static std::optional<storage::StorageValue> decodeStatsValue(const std::string& encoded,
+    LogicalTypeID typeID) {
+    switch (typeID) {
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+        return decodeStatsValue<int32_t, int64_t>(encoded);
+    case LogicalTypeID::INT64:
+        return decodeStatsValue<int64_t, int64_t>(encoded);
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+        return decodeStatsValue<uint32_t, uint64_t>(encoded);
+    case LogicalTypeID::UINT64:
+        return decodeStatsValue<uint64_t, uint64_t>(encoded);
+    default:
+        return std::nullopt;
+    }
+}
+
+static storage::MergedColumnChunkStats getColumnChunkStats(const ColumnMetaData& columnMetadata,
+    LogicalTypeID typeID) {
+    storage::ColumnChunkStats stats;
+    auto& statistics = columnMetadata.statistics;
+    auto isSigned = !LogicalTypeUtils::isUnsigned(typeID);
+    // The deprecated min and max fields use signed comparison, so they are only valid for signed
+    // columns.
+    if (statistics.__isset.min_value && statistics.__isset.max_value) {
+        stats.min = decodeStatsValue(statistics.min_value, typeID);
+        stats.max = decodeStatsValue(statistics.max_value, typeID);
+    } else if (isSigned && statistics.__isset.min && statistics.__isset.max) {
+        stats.min = decodeStatsValue(statistics.min, typeID);
+        stats.max = decodeStatsValue(statistics.max, typeID);
+    }
+    auto hasNullCount = statistics.__isset.null_count;
+    return storage::MergedColumnChunkStats{stats, hasNullCount && statistics.null_count == 0,
+        hasNullCount && statistics.null_count == columnMetadata.num_values};
+}
+
+// Statistics are compared using the physical type of the constant. They are only comparable if
+// the constant is an integer of the same signedness that is at least as wide as the column.
+static bool canCheckStats(const storage::ColumnPredicate& predicate, LogicalTypeID columnTypeID) {
+    auto constantPredicate = dynamic_cast<const storage::ColumnConstantPredicate*>(&predicate);
+    if (constantPredicate == nullptr) {
+        return true;
+    }
+    auto& value = constantPredicate->getValue();
+    if (value.isNull()) {
+        return false;
+    }
+    auto valueTypeID = value.getDataType().getLogicalTypeID();
+    if (!LogicalTypeUtils::isIntegral(valueTypeID) || valueTypeID == LogicalTypeID::INT128 ||
+        LogicalTypeUtils::isUnsigned(valueTypeID) != LogicalTypeUtils::isUnsigned(columnTypeID)) {
+        return false;
+    }
+    auto valueSize = PhysicalTypeUtils::getFixedTypeSize(value.getDataType().getPhysicalType());
+    auto columnSize =
+        PhysicalTypeUtils::getFixedTypeSize(LogicalType(columnTypeID).getPhysicalType());
+    return valueSize >= columnSize;
+}
+
+bool ParquetReader::canSkipRowGroup(uint64_t groupIdx,
+    const std::vector<storage::ColumnPredicateSet>& columnPredicates) const {
+    KU_ASSERT(groupIdx < metadata->row_groups.size());
+    auto& group = metadata->row_groups[groupIdx];
+    auto numColumns = std::min(columnPredicates.size(), columnStatsInfos.size());
+    for (auto i = 0u; i < numColumns; i++) {
+        auto& info = columnStatsInfos[i];
+        if (columnPredicates[i].isEmpty() || info.chunkIdx == INVALID_IDX ||
+            info.chunkIdx >= group.columns.size()) {
+            continue;
+        }
+        auto& chunk = group.columns[info.chunkIdx];
+        if (!chunk.__isset.meta_data || !chunk.meta_data.__isset.statistics) {
+            continue;
+        }
+        auto stats = getColumnChunkStats(chunk.meta_data, info.typeID);
+        for (auto& predicate : columnPredicates[i].getPredicates()) {
+            if (canCheckStats(*predicate, info.typeID) &&
+                predicate->checkZoneMap(stats) == ZoneMapCheckResult::SKIP_SCAN) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 std::unique_ptr<ColumnReader> ParquetReader::createReaderRecursive(uint64_t depth,
     uint64_t maxDefine, uint64_t maxRepeat, uint64_t& nextSchemaIdx, uint64_t& nextFileIdx) {
     KU_ASSERT(nextSchemaIdx < metadata->schema.size());
@@ -578,9 +718,10 @@ uint64_t ParquetReader::getGroupOffset(ParquetReaderScanState& state) {
 }
 
 ParquetScanSharedState::ParquetScanSharedState(FileScanInfo fileScanInfo, uint64_t numRows,
-    main::ClientContext* context, std::vector<bool> columnSkips)
+    main::ClientContext* context, std::vector<bool> columnSkips,
+    std::vector<storage::ColumnPredicateSet> columnPredicates)
     : ScanFileWithProgressSharedState{std::move(fileScanInfo), numRows, context},
-      columnSkips{columnSkips} {
+      columnSkips{columnSkips}, columnPredicates{std::move(columnPredicates)} {
     readers.push_back(std::make_unique<ParquetReader>(this->fileScanInfo.filePaths[fileIdx],
         columnSkips, context));
     totalRowsGroups = 0;
@@ -601,6 +742,11 @@ static bool parquetSharedStateNext(ParquetScanLocalState& localState,
         }
         if (sharedState.blockIdx < sharedState.readers[sharedState.fileIdx]->getNumRowsGroups()) {
             localState.reader = sharedState.readers[sharedState.fileIdx].get();
+            if (localState.reader->canSkipRowGroup(sharedState.blockIdx,
+                    sharedState.columnPredicates)) {
+                sharedState.blockIdx++;
+                continue;
+            }
             localState.reader->initializeScan(*localState.state, {sharedState.blockIdx},
                 sharedState.context->getVFSUnsafe());
             sharedState.blockIdx++;
@@ -705,8 +851,13 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
 static std::unique_ptr<TableFuncSharedState> initSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto bindData = input.bindData->constPtrCast<ScanFileBindData>();
+    std::vector<storage::ColumnPredicateSet> columnPredicates;
+    if (bindData->context->getClientConfig()->enableZoneMap) {
+        columnPredicates = copyVector(bindData->getColumnPredicates());
+    }
     return std::make_unique<ParquetScanSharedState>(bindData->fileScanInfo.copy(),
-        bindData->numRows, bindData->context, bindData->getColumnSkips());
+        bindData->numRows, bindData->context, bindData->getColumnSkips(),
+        std::move(columnPredicates));
 }
 
 static std::unique_ptr<TableFuncLocalState> initLocalState(
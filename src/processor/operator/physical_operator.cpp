@@ -62,6 +62,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "IMPORT_DATABASE";
     case PhysicalOperatorType::INDEX_LOOKUP:
         return "INDEX_LOOKUP";
+    case PhysicalOperatorType::INDEX_SCAN_NODE_TABLE:
+        return "INDEX_SCAN_NODE_TABLE";
     case PhysicalOperatorType::INSERT:
         return "INSERT";
     case PhysicalOperatorType::INTERSECT_BUILD:
@@ -82,6 +82,69 @@ static bool requireRelID(const RJAlgorithm& function) {
     return false;
 }
 
+// Returns the only node the output is restricted to, or nothing if there is no such single node.
+static std::optional<nodeID_t> getSingleOutputNodeID(NodeOffsetMaskMap* outputNodeMask,
+    const table_id_set_t& outputTableIDs) {
+    if (outputNodeMask == nullptr) {
+        return std::nullopt;
+    }
+    std::optional<nodeID_t> result;
+    for (auto tableID : outputTableIDs) {
+        if (!outputNodeMask->containsTableID(tableID)) {
+            return std::nullopt;
+        }
+        auto mask = outputNodeMask->getOffsetMask(tableID);
+        if (!mask->isEnabled()) {
+            return std::nullopt;
+        }
+        auto numMaskedNodes = mask->getNumMaskedNodes();
+        if (numMaskedNodes == 0) {
+            continue;
+        }
+        if (numMaskedNodes > 1 || result.has_value()) {
+            return std::nullopt;
+        }
+        result = nodeID_t{mask->collectMaskedNodes(1)[0], tableID};
+    }
+    return result;
+}
+
+// The length of a single shortest path between a given source and destination can be found by
+// searching from both ends, which explores far fewer nodes than searching from the source only.
+static bool canSearchBidirectionally(const RJAlgorithm& function, const RJBindData& bindData,
+    const RecursiveExtendSharedState& sharedState) {
+    if (function.getFunctionName() != SingleSPDestinationsFunction::name ||
+        bindData.lowerBound > 1 || sharedState.getPathNodeMaskMap() != nullptr) {
+        return false;
+    }
+    // Node predicates are applied to neighbors only, so they would not be applied to the
+    // destination when searching from it.
+    for (auto& nodeInfo : bindData.graphEntry.nodeInfos) {
+        if (nodeInfo.predicate != nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes the output of SingleSPDestinationsFunction for a (source, destination) pair.
+static void writeShortestPathLength(RecursiveExtendSharedState& sharedState,
+    storage::MemoryManager* mm, nodeID_t sourceNodeID, nodeID_t dstNodeID, uint16_t length) {
+    auto state = DataChunkState::getSingleValueDataChunkState();
+    ValueVector srcNodeIDVector{LogicalType::INTERNAL_ID(), mm, state};
+    ValueVector dstNodeIDVector{LogicalType::INTERNAL_ID(), mm, state};
+    ValueVector lengthVector{LogicalType::UINT16(), mm, state};
+    srcNodeIDVector.setValue<nodeID_t>(0, sourceNodeID);
+    dstNodeIDVector.setValue<nodeID_t>(0, dstNodeID);
+    lengthVector.setValue<uint16_t>(0, length);
+    auto localFT = sharedState.factorizedTablePool.claimLocalTable(mm);
+    localFT->append({&srcNodeIDVector, &dstNodeIDVector, &lengthVector});
+    sharedState.factorizedTablePool.returnLocalTable(localFT);
+    if (sharedState.counter != nullptr) {
+        sharedState.counter->increase(1);
+    }
+}
+
 void RecursiveExtend::executeInternal(ExecutionContext* context) {
     auto clientContext = context->clientContext;
     auto graph = sharedState->graph.get();
@@ -102,6 +165,11 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         propertyNames.push_back(
             bindData.weightPropertyExpr->ptrCast<PropertyExpression>()->getPropertyName());
     }
+    std::optional<nodeID_t> singleDstNodeID;
+    if (canSearchBidirectionally(*function, bindData, *sharedState)) {
+        singleDstNodeID = getSingleOutputNodeID(sharedState->getOutputNodeMaskMap(),
+            bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet());
+    }
     offset_t completedNumNodes = 0;
     auto inputNodeTableIDSet = bindData.nodeInput->constCast<NodeExpression>().getTableIDsSet();
     for (auto& tableID : graph->getNodeTableIDs()) {
@@ -112,8 +180,19 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         if (!inputNodeTableIDSet.contains(tableID)) {
             continue;
         }
-        auto calcFunc = [tableID, propertyNames, graph, context, this](offset_t offset) {
+        auto calcFunc = [tableID, propertyNames, graph, context, singleDstNodeID,
+                            this](offset_t offset) {
             auto clientContext = context->clientContext;
+            if (singleDstNodeID.has_value()) {
+                auto sourceNodeID = nodeID_t{offset, tableID};
+                auto length = GDSUtils::runBidirectionalShortestPath(context, graph, sourceNodeID,
+                    *singleDstNodeID, bindData.extendDirection, bindData.upperBound);
+                if (length.has_value()) {
+                    writeShortestPathLength(*sharedState, clientContext->getMemoryManager(),
+                        sourceNodeID, *singleDstNodeID, *length);
+                }
+                return;
+            }
             auto computeState = function->getComputeState(context, bindData, sharedState.get());
             auto sourceNodeID = nodeID_t{offset, tableID};
             computeState->initSource(sourceNodeID);
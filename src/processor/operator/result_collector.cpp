@@ -1,5 +1,7 @@
 #include "processor/operator/result_collector.h"
 
+#include <unordered_set>
+
 #include "binder/expression/expression_util.h"
 #include "processor/execution_context.h"
 
@@ -55,6 +57,37 @@ void ResultCollector::executeInternal(ExecutionContext* context) {
     }
 }
 
+static uint64_t getNumFlatTuples(const std::vector<ValueVector*>& vectors) {
+    // Vectors of the same unflat data chunk share their state.
+    std::unordered_set<DataChunkState*> unflatStates;
+    uint64_t numTuples = 1;
+    for (auto vector : vectors) {
+        auto state = vector->state.get();
+        if (!state->isFlat() && unflatStates.insert(state).second) {
+            numTuples *= state->getSelVector().getSelSize();
+        }
+    }
+    return numTuples;
+}
+
+bool ResultCollector::fetchTuples(ExecutionContext* context, uint64_t numTuples) {
+    KU_ASSERT(info.accumulateType == AccumulateType::REGULAR);
+    auto table = sharedState->getTable();
+    uint64_t numFetchedTuples = 0;
+    while (numFetchedTuples < numTuples) {
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        if (!payloadVectors.empty()) {
+            for (auto i = 0u; i < resultSet->multiplicity; i++) {
+                table->append(payloadAndMarkVectors);
+            }
+            numFetchedTuples += getNumFlatTuples(payloadVectors) * resultSet->multiplicity;
+        }
+    }
+    return true;
+}
+
 void ResultCollector::finalizeInternal(ExecutionContext* context) {
     switch (info.accumulateType) {
     case AccumulateType::OPTIONAL_: {
@@ -0,0 +1,97 @@
+#include "processor/operator/scan/index_scan_node_table.h"
+
+#include "binder/expression/expression_util.h"
+#include "processor/execution_context.h"
+#include "storage/index/btree_index.h"
+#include "storage/local_storage/local_node_table.h"
+#include "storage/local_storage/local_storage.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+std::string IndexScanPrintInfo::toString() const {
+    std::string result = "Index: ";
+    result += indexName;
+    result += ", Range: ";
+    result += range;
+    if (!alias.empty()) {
+        result += ",Alias: ";
+        result += alias;
+    }
+    result += ", Expressions: ";
+    result += binder::ExpressionUtil::toString(expressions);
+    return result;
+}
+
+void IndexScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    ScanTable::initLocalStateInternal(resultSet, context);
+    auto nodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
+    scanState = std::make_unique<NodeTableScanState>(nodeIDVector, std::vector<ValueVector*>{},
+        nodeIDVector->state);
+    for (auto bound : {&lowerBound, &upperBound}) {
+        if (bound->evaluator != nullptr) {
+            bound->evaluator->init(*resultSet, context->clientContext);
+        }
+    }
+}
+
+static BTreeKeyBound evaluateBound(const IndexScanBound& bound) {
+    if (bound.evaluator == nullptr) {
+        return BTreeKeyBound{};
+    }
+    bound.evaluator->evaluate();
+    return BTreeKeyBound{bound.evaluator->resultVector.get(), bound.inclusive};
+}
+
+void IndexScanNodeTable::lookupIndex(const transaction::Transaction* transaction) {
+    auto& table = tableInfo.table->cast<NodeTable>();
+    const auto index = table.getIndex(indexName);
+    KU_ASSERT(index.has_value());
+    index.value()->cast<BTreeIndex>().lookup(evaluateBound(lowerBound), evaluateBound(upperBound),
+        offsets);
+    // Entries of rolled back insertions may point past the committed rows.
+    const auto numCommittedRows = table.getNumTotalRows(nullptr /* transaction */);
+    offsets.erase(std::lower_bound(offsets.begin(), offsets.end(), numCommittedRows),
+        offsets.end());
+    // Rows inserted by the current transaction are only indexed on commit, so all of them are
+    // scanned. Their values are checked by the filter on top of this operator.
+    if (transaction->isWriteTransaction()) {
+        if (const auto localTable =
+                transaction->getLocalStorage()->getLocalTable(table.getTableID())) {
+            auto& localNodeTable = localTable->cast<LocalNodeTable>();
+            const auto startOffset = localNodeTable.getStartOffset();
+            for (auto i = 0u; i < localNodeTable.getNumTotalRows(); i++) {
+                offsets.push_back(startOffset + i);
+            }
+        }
+    }
+}
+
+bool IndexScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
+    auto transaction = context->clientContext->getTransaction();
+    if (!initialized) {
+        lookupIndex(transaction);
+        initialized = true;
+    }
+    auto& table = tableInfo.table->cast<NodeTable>();
+    const auto pos = scanState->nodeIDVector->state->getSelVector()[0];
+    while (cursor < offsets.size()) {
+        const auto nodeOffset = offsets[cursor++];
+        scanState->nodeIDVector->setValue<nodeID_t>(pos, nodeID_t{nodeOffset, table.getTableID()});
+        tableInfo.initScanState(*scanState, outVectors, context->clientContext);
+        table.initScanState(transaction, *scanState, table.getTableID(), nodeOffset);
+        if (table.lookup(transaction, *scanState)) {
+            tableInfo.castColumns();
+            metrics->numOutputTuple.incrementByOne();
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace processor
+} // namespace kuzu
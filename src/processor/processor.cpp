@@ -38,6 +38,23 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalP
     return sink->getResultFTable();
 }
 
+bool QueryProcessor::executeDependencies(PhysicalPlan* physicalPlan, ExecutionContext* context) {
+    auto sink = physicalPlan->lastOperator->ptrCast<Sink>();
+    auto task = std::make_shared<ProcessorTask>(sink, context);
+    for (auto i = (int64_t)sink->getNumChildren() - 1; i >= 0; --i) {
+        decomposePlanIntoTask(sink->getChild(i), task.get(), context);
+    }
+    initTask(task.get());
+    context->clientContext->getProgressBar()->startProgress(context->queryID);
+    for (auto& dependency : task->children) {
+        taskScheduler->scheduleTaskAndWaitOrError(dependency, context);
+        if (dependency->terminate()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     ExecutionContext* context) {
     if (op->isSource()) {
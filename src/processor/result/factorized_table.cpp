@@ -7,6 +7,7 @@
 #include "common/null_buffer.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -41,6 +42,22 @@ void DataBlock::preventDestruction() {
     block->preventDestruction();
 }
 
+void DataBlock::spillToDisk(const Spiller& spiller) {
+    spiller.spillToDisk(*block);
+}
+
+void DataBlock::loadFromDisk(const Spiller& spiller) {
+    spiller.loadFromDisk(*block);
+}
+
+void DataBlock::unloadToDisk(const Spiller& spiller) {
+    spiller.unloadToDisk(*block);
+}
+
+bool DataBlock::isSpilled() const {
+    return block->isEvicted();
+}
+
 void DataBlock::copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
     DataBlock* blockToCopyInto, ft_tuple_idx_t tupleIdxToCopyTo, uint32_t numTuplesToCopy,
     uint32_t numBytesPerTuple) {
@@ -340,6 +357,41 @@ void FactorizedTable::clear() {
     inMemOverflowBuffer->resetBuffer();
 }
 
+uint64_t FactorizedTable::spillFlatTupleBlocks(const Spiller& spiller, bool keepLastBlock) {
+    auto& blocks = flatTupleBlockCollection->getBlocks();
+    auto numBlocksToSpill = keepLastBlock && !blocks.empty() ? blocks.size() - 1 : blocks.size();
+    uint64_t numBytesSpilled = 0;
+    // Blocks are spilled in order, so the spilled blocks always form a prefix of the collection.
+    for (auto i = numBlocksToSpill; i > 0 && !blocks[i - 1]->isSpilled(); i--) {
+        blocks[i - 1]->spillToDisk(spiller);
+        numBytesSpilled += flatTupleBlockSize;
+    }
+    return numBytesSpilled;
+}
+
+uint64_t FactorizedTable::loadFlatTupleBlocks(const Spiller& spiller) {
+    uint64_t numBytesRead = 0;
+    for (auto& block : flatTupleBlockCollection->getBlocks()) {
+        if (block->isSpilled()) {
+            block->loadFromDisk(spiller);
+            numBytesRead += flatTupleBlockSize;
+        }
+    }
+    return numBytesRead;
+}
+
+void FactorizedTable::unloadFlatTupleBlocks(const Spiller& spiller) {
+    for (auto& block : flatTupleBlockCollection->getBlocks()) {
+        block->unloadToDisk(spiller);
+    }
+}
+
+uint64_t FactorizedTable::getNumResidentFlatTupleBlocks() const {
+    return std::count_if(flatTupleBlockCollection->getBlocks().begin(),
+        flatTupleBlockCollection->getBlocks().end(),
+        [](const auto& block) { return !block->isSpilled(); });
+}
+
 void FactorizedTable::setOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx,
     ft_tuple_idx_t tupleIdx) {
     NullBuffer::setNull(nullBuffer, tupleIdx);
@@ -654,11 +706,7 @@ FlatTupleIterator::FlatTupleIterator(FactorizedTable& factorizedTable, std::vect
 void FlatTupleIterator::getNextFlatTuple() {
     // Go to the next tuple if we have iterated all the flat tuples of the current tuple.
     if (nextFlatTupleIdx >= numFlatTuples) {
-        currentTupleBuffer = factorizedTable.getTuple(nextTupleIdx);
-        numFlatTuples = factorizedTable.getNumFlatTuples(nextTupleIdx);
-        nextFlatTupleIdx = 0;
-        updateNumElementsInDataChunk();
-        nextTupleIdx++;
+        readNextTuple();
     }
     for (auto i = 0ul; i < factorizedTable.getTableSchema()->getNumColumns(); i++) {
         auto column = factorizedTable.getTableSchema()->getColumn(i);
@@ -684,6 +732,41 @@ void FlatTupleIterator::resetState() {
     }
 }
 
+std::pair<ft_tuple_idx_t, uint64_t> FlatTupleIterator::getNextFlatTuplePos() const {
+    if (nextFlatTupleIdx < numFlatTuples) {
+        return {nextTupleIdx - 1, nextFlatTupleIdx};
+    }
+    return {nextTupleIdx, 0};
+}
+
+void FlatTupleIterator::skipFlatTuples(uint64_t numFlatTuplesToSkip) {
+    while (numFlatTuplesToSkip > 0) {
+        if (nextFlatTupleIdx >= numFlatTuples) {
+            readNextTuple();
+        }
+        auto numToSkip = std::min(numFlatTuplesToSkip, numFlatTuples - nextFlatTupleIdx);
+        nextFlatTupleIdx += numToSkip;
+        numFlatTuplesToSkip -= numToSkip;
+    }
+    // With a single unflat group, the position in its data chunk is the flat tuple index, and
+    // wraps to 0 once all flat tuples of the current tuple have been read.
+    for (auto i = 0u; i < flatTuplePositionsInDataChunk.size(); i++) {
+        if (!isValidDataChunkPos(i)) {
+            continue;
+        }
+        auto& [nextIdxToRead, numElements] = flatTuplePositionsInDataChunk[i];
+        nextIdxToRead = nextFlatTupleIdx < numElements ? nextFlatTupleIdx : 0;
+    }
+}
+
+void FlatTupleIterator::readNextTuple() {
+    currentTupleBuffer = factorizedTable.getTuple(nextTupleIdx);
+    numFlatTuples = factorizedTable.getNumFlatTuples(nextTupleIdx);
+    nextFlatTupleIdx = 0;
+    updateNumElementsInDataChunk();
+    nextTupleIdx++;
+}
+
 void FlatTupleIterator::readUnflatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* valueBuffer) {
     auto overflowValue =
         (overflow_value_t*)(valueBuffer + factorizedTable.getTableSchema()->getColOffset(colIdx));
@@ -14,6 +14,7 @@
 #include "common/file_system/virtual_file_system.h"
 #include "common/types/types.h"
 #include "main/db_config.h"
+#include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/file_handle.h"
 #include "storage/table/column_chunk_data.h"
@@ -66,7 +67,8 @@ void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
 BufferManager::BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
     uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly)
     : bufferPoolSize{bufferPoolSize}, evictionQueue{bufferPoolSize / KUZU_PAGE_SIZE},
-      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs} {
+      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs},
+      memoryManager{nullptr} {
     verifySizeParams(bufferPoolSize, maxDBSize);
 #if !BM_MALLOC
     vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize);
@@ -378,6 +380,10 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
             }
         }
         if (memoryClaimed == 0 && needMoreMemory()) {
+            // Blocks cached by the memory manager are accounted as used memory, but can be freed.
+            if (memoryManager != nullptr && memoryManager->releaseCachedBlocks() > 0) {
+                continue;
+            }
             if (failedCount++ < 2) {
                 // If we failed to find any memory to free, try waiting briefly for other threads to
                 // stop using memory
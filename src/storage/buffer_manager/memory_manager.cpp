@@ -1,6 +1,8 @@
 #include "storage/buffer_manager/memory_manager.h"
 
+#include <atomic>
 #include <mutex>
+#include <thread>
 
 #include "common/exception/buffer_manager.h"
 #include "common/file_system/virtual_file_system.h"
@@ -18,8 +20,7 @@ MemoryBuffer::MemoryBuffer(MemoryManager* mm, page_idx_t pageIdx, uint8_t* buffe
 
 MemoryBuffer::~MemoryBuffer() {
     if (buffer.data() != nullptr && !evicted) {
-        mm->freeBlock(pageIdx, buffer);
-        mm->updateUsedMemoryForFreedBlock(pageIdx, buffer);
+        mm->releaseBlock(pageIdx, buffer);
         buffer = std::span<uint8_t>();
     }
 }
@@ -33,20 +34,46 @@ SpillResult MemoryBuffer::setSpilledToDisk(uint64_t filePosition) {
     this->filePosition = filePosition;
     if (pageIdx == INVALID_PAGE_IDX) {
         return SpillResult{buffer.size(), 0};
-    } else {
-        return SpillResult{0, buffer.size()};
     }
+    // The unpinned page can be handed out again; the buffer gets a new block when reloaded.
+    mm->updateUsedMemoryForFreedBlock(pageIdx, buffer);
+    pageIdx = INVALID_PAGE_IDX;
+    return SpillResult{0, buffer.size()};
 }
 
 void MemoryBuffer::prepareLoadFromDisk() {
     KU_ASSERT(buffer.data() == nullptr && evicted);
-    buffer = mm->mallocBuffer(false, buffer.size());
+    buffer = mm->allocateBlock(false /* initializeToZero */, buffer.size(), pageIdx);
     evicted = false;
 }
 
 MemoryManager::MemoryManager(BufferManager* bm, VirtualFileSystem* vfs) : bm{bm} {
     pageSize = TEMP_PAGE_SIZE;
     fh = bm->getFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE, vfs, nullptr);
+    const auto numShards = std::max(1u, std::thread::hardware_concurrency());
+    for (auto i = 0u; i < numShards; i++) {
+        shards.push_back(std::make_unique<AllocatorShard>());
+    }
+    bm->memoryManager = this;
+}
+
+MemoryManager::~MemoryManager() {
+    bm->memoryManager = nullptr;
+    releaseCachedBlocks();
+}
+
+uint64_t MemoryManager::getSizeClass(uint64_t size) {
+    if (size < MIN_CACHED_BLOCK_SIZE || size > MAX_CACHED_BLOCK_SIZE || size == TEMP_PAGE_SIZE ||
+        !std::has_single_bit(size)) {
+        return UINT64_MAX;
+    }
+    return std::countr_zero(size) - std::countr_zero(MIN_CACHED_BLOCK_SIZE);
+}
+
+MemoryManager::AllocatorShard& MemoryManager::getShard() const {
+    static std::atomic<uint64_t> nextThreadIdx{0};
+    thread_local const uint64_t threadIdx = nextThreadIdx.fetch_add(1);
+    return *shards[threadIdx % shards.size()];
 }
 
 std::span<uint8_t> MemoryManager::mallocBuffer(bool initializeToZero, uint64_t size) {
@@ -65,26 +92,94 @@ std::span<uint8_t> MemoryManager::mallocBuffer(bool initializeToZero, uint64_t s
 }
 
 std::unique_ptr<MemoryBuffer> MemoryManager::allocateBuffer(bool initializeToZero, uint64_t size) {
+    page_idx_t pageIdx = INVALID_PAGE_IDX;
+    auto buffer = allocateBlock(initializeToZero, size, pageIdx);
+    return std::make_unique<MemoryBuffer>(this, pageIdx, buffer.data(), size);
+}
+
+std::span<uint8_t> MemoryManager::allocateBlock(bool initializeToZero, uint64_t size,
+    page_idx_t& pageIdx) {
+    auto& shard = getShard();
     if (size != TEMP_PAGE_SIZE) [[unlikely]] {
-        auto buffer = mallocBuffer(initializeToZero, size);
-        return std::make_unique<MemoryBuffer>(this, INVALID_PAGE_IDX, buffer.data(), size);
+        pageIdx = INVALID_PAGE_IDX;
+        const auto sizeClass = getSizeClass(size);
+        if (sizeClass != UINT64_MAX) {
+            uint8_t* block = nullptr;
+            {
+                std::scoped_lock<std::mutex> lock(shard.mtx);
+                auto& freeBlocks = shard.freeBlocks[sizeClass];
+                if (!freeBlocks.empty()) {
+                    block = freeBlocks.back();
+                    freeBlocks.pop_back();
+                    shard.numCachedBytes -= size;
+                }
+            }
+            if (block != nullptr) {
+                if (initializeToZero) {
+                    memset(block, 0, size);
+                }
+                return std::span(block, size);
+            }
+        }
+        return mallocBuffer(initializeToZero, size);
     }
-    page_idx_t pageIdx = INVALID_PAGE_IDX;
     {
-        std::scoped_lock<std::mutex> lock(allocatorLock);
-        if (freePages.empty()) {
-            pageIdx = fh->addNewPage();
-        } else {
-            pageIdx = freePages.top();
-            freePages.pop();
+        std::scoped_lock<std::mutex> lock(shard.mtx);
+        if (shard.freePages.empty()) {
+            std::scoped_lock<std::mutex> globalLock(allocatorLock);
+            const auto numPagesToTake = std::min<uint64_t>(FREE_PAGE_BATCH_SIZE, freePages.size());
+            shard.freePages.insert(shard.freePages.end(), freePages.end() - numPagesToTake,
+                freePages.end());
+            freePages.resize(freePages.size() - numPagesToTake);
+            if (shard.freePages.empty()) {
+                shard.freePages.push_back(fh->addNewPage());
+            }
         }
+        pageIdx = shard.freePages.back();
+        shard.freePages.pop_back();
     }
     auto buffer = bm->pin(*fh, pageIdx, PageReadPolicy::DONT_READ_PAGE);
-    auto memoryBuffer = std::make_unique<MemoryBuffer>(this, pageIdx, buffer);
     if (initializeToZero) {
-        memset(memoryBuffer->getBuffer().data(), 0, pageSize);
+        memset(buffer, 0, pageSize);
+    }
+    return std::span(buffer, pageSize);
+}
+
+void MemoryManager::releaseBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
+    if (pageIdx == INVALID_PAGE_IDX) {
+        const auto sizeClass = getSizeClass(buffer.size());
+        if (sizeClass != UINT64_MAX) {
+            auto& shard = getShard();
+            std::scoped_lock<std::mutex> lock(shard.mtx);
+            if (shard.numCachedBytes + buffer.size() <= MAX_CACHED_BYTES_PER_SHARD) {
+                shard.freeBlocks[sizeClass].push_back(buffer.data());
+                shard.numCachedBytes += buffer.size();
+                return;
+            }
+        }
     }
-    return memoryBuffer;
+    freeBlock(pageIdx, buffer);
+    updateUsedMemoryForFreedBlock(pageIdx, buffer);
+}
+
+uint64_t MemoryManager::releaseCachedBlocks() {
+    uint64_t numBytesFreed = 0;
+    for (auto& shard : shards) {
+        std::scoped_lock<std::mutex> lock(shard->mtx);
+        for (auto& freeBlocks : shard->freeBlocks) {
+            for (auto* block : freeBlocks) {
+                std::free(block);
+            }
+            freeBlocks.clear();
+        }
+        numBytesFreed += shard->numCachedBytes;
+        shard->numCachedBytes = 0;
+    }
+    if (numBytesFreed > 0) {
+        bm->freeUsedMemory(numBytesFreed);
+        bm->nonEvictableMemory -= numBytesFreed;
+    }
+    return numBytesFreed;
 }
 
 void MemoryManager::freeBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
@@ -100,8 +195,16 @@ void MemoryManager::updateUsedMemoryForFreedBlock(page_idx_t pageIdx, std::span<
         bm->freeUsedMemory(buffer.size());
         bm->nonEvictableMemory -= buffer.size();
     } else {
-        std::unique_lock<std::mutex> lock(allocatorLock);
-        freePages.push(pageIdx);
+        auto& shard = getShard();
+        std::scoped_lock<std::mutex> lock(shard.mtx);
+        shard.freePages.push_back(pageIdx);
+        // Hand a batch of pages back to the global free list so that other shards can reuse them.
+        if (shard.freePages.size() > 2 * FREE_PAGE_BATCH_SIZE) {
+            std::scoped_lock<std::mutex> globalLock(allocatorLock);
+            freePages.insert(freePages.end(), shard.freePages.end() - FREE_PAGE_BATCH_SIZE,
+                shard.freePages.end());
+            shard.freePages.resize(shard.freePages.size() - FREE_PAGE_BATCH_SIZE);
+        }
     }
 }
 
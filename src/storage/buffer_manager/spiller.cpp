@@ -17,7 +17,8 @@ namespace storage {
 
 Spiller::Spiller(std::string tmpFilePath, BufferManager& bufferManager,
     common::VirtualFileSystem* vfs)
-    : tmpFilePath{std::move(tmpFilePath)}, bufferManager{bufferManager}, vfs{vfs}, dataFH{nullptr} {
+    : tmpFilePath{std::move(tmpFilePath)}, bufferManager{bufferManager}, vfs{vfs}, dataFH{nullptr},
+      numActiveOperatorStates{0} {
     // Clear the file if it already existed (e.g. from a previous run which
     // failed to clean up).
     vfs->removeFileIfExists(this->tmpFilePath);
@@ -66,18 +67,21 @@ Spiller::~Spiller() {
 }
 
 SpillResult Spiller::spillToDisk(ColumnChunkData& chunk) const {
-    auto& buffer = *chunk.buffer;
-    KU_ASSERT(!buffer.evicted);
-    auto dataFH = getOrCreateDataFH();
-    auto pageSize = dataFH->getPageSize();
-    auto numPages = (buffer.buffer.size_bytes() + pageSize - 1) / pageSize;
-    auto startPage = dataFH->addNewPages(numPages);
-    dataFH->writePagesToFile(buffer.buffer.data(), buffer.buffer.size_bytes(), startPage);
-    return buffer.setSpilledToDisk(startPage * pageSize);
+    // Memory freed here is accounted for by BufferManager::reserve, which claims the group.
+    return writeToDisk(*chunk.buffer);
 }
 
 void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
-    auto& buffer = *chunk.buffer;
+    loadFromDisk(*chunk.buffer);
+}
+
+SpillResult Spiller::spillToDisk(MemoryBuffer& buffer) const {
+    auto result = writeToDisk(buffer);
+    releaseFreedMemory(result);
+    return result;
+}
+
+void Spiller::loadFromDisk(MemoryBuffer& buffer) const {
     if (buffer.evicted) {
         buffer.prepareLoadFromDisk();
         auto dataFH = getDataFH();
@@ -87,6 +91,32 @@ void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
     }
 }
 
+SpillResult Spiller::unloadToDisk(MemoryBuffer& buffer) const {
+    KU_ASSERT(!buffer.evicted && buffer.filePosition != UINT64_MAX);
+    auto result = buffer.setSpilledToDisk(buffer.filePosition);
+    releaseFreedMemory(result);
+    return result;
+}
+
+SpillResult Spiller::writeToDisk(MemoryBuffer& buffer) const {
+    KU_ASSERT(!buffer.evicted);
+    auto dataFH = getOrCreateDataFH();
+    auto pageSize = dataFH->getPageSize();
+    auto numPages = (buffer.buffer.size_bytes() + pageSize - 1) / pageSize;
+    auto startPage = dataFH->addNewPages(numPages);
+    dataFH->writePagesToFile(buffer.buffer.data(), buffer.buffer.size_bytes(), startPage);
+    return buffer.setSpilledToDisk(startPage * pageSize);
+}
+
+void Spiller::releaseFreedMemory(const SpillResult& result) const {
+    // Buffers which weren't backed by the buffer manager were freed directly, so their memory
+    // needs to be given back to the buffer manager.
+    if (result.memoryFreed > 0) {
+        bufferManager.freeUsedMemory(result.memoryFreed);
+        bufferManager.nonEvictableMemory -= result.memoryFreed;
+    }
+}
+
 SpillResult Spiller::claimNextGroup() {
     ChunkedNodeGroup* groupToFlush = nullptr;
     {
@@ -105,6 +135,9 @@ SpillResult Spiller::claimNextGroup() {
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Function shouldn't be re-ordered
 void Spiller::clearFile() {
+    if (numActiveOperatorStates > 0) {
+        return;
+    }
     auto curDataFH = getDataFH();
     if (curDataFH) {
         curDataFH->getFileInfo()->truncate(0);
@@ -8,8 +8,11 @@
 #include "common/serializer/deserializer.h"
 #include "common/serializer/in_mem_file_writer.h"
 #include "extension/extension_manager.h"
+#include "main/database.h"
 #include "main/db_config.h"
+#include "main/plan_cache.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/index/btree_index.h"
 #include "storage/shadow_utils.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_version_info.h"
@@ -121,6 +124,8 @@ void Checkpointer::writeCheckpoint() {
     bufferManager->removeEvictedCandidates();
 
     clientContext.getCatalog()->resetVersion();
+    // Cached plans are tagged with the catalog version, which restarts from 0 after a checkpoint.
+    clientContext.getDatabase()->getPlanCache()->clear();
     auto* dataFH = storageManager->getDataFH();
     dataFH->getPageManager()->resetVersion();
     storageManager->getWAL().reset();
@@ -225,13 +230,17 @@ static void validateStorageVersion(common::Deserializer& deSer) {
     storage_version_t savedStorageVersion = 0;
     deSer.deserializeValue(savedStorageVersion);
     const auto storageVersion = StorageVersionInfo::getStorageVersion();
-    if (savedStorageVersion != storageVersion) {
+    if (savedStorageVersion < StorageVersionInfo::MIN_SUPPORTED_STORAGE_VERSION ||
+        savedStorageVersion > storageVersion) {
         // TODO(Guodong): Add a test case for this.
         throw common::RuntimeException(
             common::stringFormat("Trying to read a database file with a different version. "
                                  "Database file version: {}, Current build storage version: {}",
                 savedStorageVersion, storageVersion));
     }
+    // The rest of the file is read in the layout of the version it was written with. The next
+    // checkpoint rewrites it in the current layout.
+    deSer.setStorageVersion(savedStorageVersion);
 }
 
 static void validateMagicBytes(common::Deserializer& deSer) {
@@ -311,6 +320,7 @@ void Checkpointer::readCheckpoint(main::ClientContext* context, catalog::Catalog
         currentHeader.metadataPageRange.startPageIdx * common::KUZU_PAGE_SIZE);
     storageManager->deserialize(context, catalog, deSer);
     storageManager->getDataFH()->getPageManager()->deserialize(deSer);
+    BTreeIndex::loadCatalogEntries(*catalog);
 }
 
 } // namespace storage
@@ -19,6 +19,7 @@
 #include "storage/compression/bitpacking_int128.h"
 #include "storage/compression/bitpacking_utils.h"
 #include "storage/compression/float_compression.h"
+#include "storage/compression/fsst.h"
 #include "storage/compression/sign_extend.h"
 #include "storage/storage_utils.h"
 #include "storage/table/column_chunk_data.h"
@@ -120,6 +121,10 @@ CompressionMetadata::CompressionMetadata(StorageValue min, StorageValue max,
     }
 }
 
+const FSSTMetadata* CompressionMetadata::fsstMetadata() const {
+    return common::ku_dynamic_cast<const FSSTMetadata*>(getExtraMetadata());
+}
+
 const CompressionMetadata& CompressionMetadata::getChild(offset_t idx) const {
     KU_ASSERT(idx < getChildCount(compression));
     return children[idx];
@@ -154,6 +159,8 @@ void CompressionMetadata::serialize(Serializer& serializer) const {
 
     if (compression == CompressionType::ALP) {
         floatMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::FSST) {
+        fsstMetadata()->serialize(serializer);
     }
 
     KU_ASSERT(children.size() == getChildCount(compression));
@@ -175,6 +182,9 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
     if (compressionType == CompressionType::ALP) {
         auto alpMetadata = std::make_unique<ALPMetadata>(ALPMetadata::deserialize(deserializer));
         ret.extraMetadata = std::move(alpMetadata);
+    } else if (compressionType == CompressionType::FSST) {
+        ret.extraMetadata =
+            std::make_unique<FSSTMetadata>(FSSTMetadata::deserialize(deserializer));
     }
 
     for (size_t i = 0; i < getChildCount(compressionType); ++i) {
@@ -187,12 +197,14 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
 bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     switch (compression) {
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
     case CompressionType::CONSTANT:
     case CompressionType::ALP:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::DELTA_BITPACKING: {
         return false;
     }
     default: {
@@ -239,7 +251,8 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
         }
     }
     case CompressionType::BOOLEAN_BITPACKING:
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return true;
     }
     case CompressionType::ALP: {
@@ -280,6 +293,10 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
                 return false;
             });
     }
+    case CompressionType::DELTA_BITPACKING: {
+        // Changing any value changes the differences to the following value.
+        return false;
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -296,7 +313,8 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
     case CompressionType::CONSTANT: {
         return std::numeric_limits<uint64_t>::max();
     }
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
         return Uncompressed::numValues(pageSize, dataType);
     }
     case CompressionType::INTEGER_BITPACKING: {
@@ -329,6 +347,25 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        switch (dataType) {
+        case PhysicalTypeID::INT64:
+            return DeltaBitpacking<int64_t>::numValues(pageSize, *this);
+        case PhysicalTypeID::INT32:
+            return DeltaBitpacking<int32_t>::numValues(pageSize, *this);
+        case PhysicalTypeID::INTERNAL_ID:
+        case PhysicalTypeID::UINT64:
+            return DeltaBitpacking<uint64_t>::numValues(pageSize, *this);
+        case PhysicalTypeID::UINT32:
+            return DeltaBitpacking<uint32_t>::numValues(pageSize, *this);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses delta bitpacking but does not "
+                "have a supported integer physical type: " +
+                PhysicalTypeUtils::toString(dataType));
+        }
+        }
+    }
     case CompressionType::ALP: {
         switch (dataType) {
         case PhysicalTypeID::DOUBLE: {
@@ -358,7 +395,8 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
 
 size_t CompressionMetadata::getChildCount(CompressionType compressionType) {
     switch (compressionType) {
-    case CompressionType::ALP: {
+    case CompressionType::ALP:
+    case CompressionType::DELTA_BITPACKING: {
         return 1;
     }
     default: {
@@ -437,6 +475,9 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
     case CompressionType::UNCOMPRESSED: {
         return "UNCOMPRESSED";
     }
+    case CompressionType::FSST: {
+        return stringFormat("FSST[{} symbols]", fsstMetadata()->symbolTable.getNumSymbols());
+    }
     case CompressionType::ALP: {
         uint8_t bitWidth = TypeUtils::visit(
             physicalType,
@@ -462,6 +503,14 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
             [](auto) -> uint8_t { KU_UNREACHABLE; });
         return stringFormat("INTEGER_BITPACKING[{}]", bitWidth);
     }
+    case CompressionType::DELTA_BITPACKING: {
+        uint8_t bitWidth = TypeUtils::visit(
+            physicalType,
+            [&](common::internalID_t) { return DeltaBitpacking<uint64_t>::getBitWidth(*this); },
+            [&]<DeltaBitpackingType T>(T) { return DeltaBitpacking<T>::getBitWidth(*this); },
+            [](auto) -> uint8_t { KU_UNREACHABLE; });
+        return stringFormat("DELTA_BITPACKING[{}]", bitWidth);
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return "BOOLEAN_BITPACKING";
     }
@@ -739,6 +788,12 @@ uint64_t IntegerBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
         return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
             dstBufferSize, metadata);
     }
+    if constexpr (DeltaBitpackingType<T>) {
+        if (metadata.compression == CompressionType::DELTA_BITPACKING) {
+            return DeltaBitpacking<T>().compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+                dstBufferSize, metadata);
+        }
+    }
     KU_ASSERT(metadata.compression == CompressionType::INTEGER_BITPACKING);
     auto info = getPackingInfo(metadata);
     auto bitWidth = info.bitWidth;
@@ -842,6 +897,153 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+template<DeltaBitpackingType T>
+CompressionMetadata DeltaBitpacking<T>::getMetadata(std::span<const T> values, StorageValue min,
+    StorageValue max) {
+    // Differences are computed with wrap-around, so they always fit in T.
+    S minDelta = 0, maxDelta = 0;
+    for (auto i = 1u; i < values.size(); i++) {
+        const auto delta =
+            static_cast<S>(static_cast<U>(values[i]) - static_cast<U>(values[i - 1]));
+        if (i == 1 || delta < minDelta) {
+            minDelta = delta;
+        }
+        if (i == 1 || delta > maxDelta) {
+            maxDelta = delta;
+        }
+    }
+    auto metadata = CompressionMetadata(min, max, CompressionType::DELTA_BITPACKING);
+    metadata.children.emplace_back(StorageValue(minDelta), StorageValue(maxDelta),
+        CompressionType::INTEGER_BITPACKING);
+    return metadata;
+}
+
+template<DeltaBitpackingType T>
+CompressionMetadata DeltaBitpacking<T>::getPackedMetadata(const CompressionMetadata& metadata) {
+    const auto& deltaMetadata = metadata.getChild(DELTA_CHILD_IDX);
+    const auto range = static_cast<U>(static_cast<U>(deltaMetadata.max.get<S>()) -
+                                      static_cast<U>(deltaMetadata.min.get<S>()));
+    return CompressionMetadata(StorageValue(U{0}), StorageValue(range),
+        CompressionType::INTEGER_BITPACKING);
+}
+
+template<DeltaBitpackingType T>
+uint8_t DeltaBitpacking<T>::getBitWidth(const CompressionMetadata& metadata) {
+    return IntegerBitpacking<U>::getPackingInfo(getPackedMetadata(metadata)).bitWidth;
+}
+
+template<DeltaBitpackingType T>
+uint64_t DeltaBitpacking<T>::getBlockSizeInBytes(uint8_t bitWidth) {
+    return sizeof(U) + BLOCK_SIZE * bitWidth / 8;
+}
+
+template<DeltaBitpackingType T>
+uint64_t DeltaBitpacking<T>::numValues(uint64_t dataSize, const CompressionMetadata& metadata) {
+    const auto bitWidth = getBitWidth(metadata);
+    const auto blockSizeInBytes = getBlockSizeInBytes(bitWidth);
+    auto numValues = dataSize / blockSizeInBytes * BLOCK_SIZE;
+    const auto remainingSize = dataSize % blockSizeInBytes;
+    if (remainingSize >= sizeof(U)) {
+        // The differences of the last block are packed in whole chunks.
+        const auto numDeltaChunks = (remainingSize - sizeof(U)) * 8 /
+                                    (bitWidth * IntegerBitpacking<U>::CHUNK_SIZE);
+        numValues += 1 + std::min<uint64_t>(BLOCK_SIZE - 1,
+                             numDeltaChunks * IntegerBitpacking<U>::CHUNK_SIZE);
+    }
+    return numValues;
+}
+
+template<DeltaBitpackingType T>
+void DeltaBitpacking<T>::setValuesFromUncompressed(const uint8_t*, offset_t, uint8_t*, offset_t,
+    offset_t, const CompressionMetadata&, const NullMask*) const {
+    // Chunks using delta encoding are always rewritten out of place.
+    KU_UNREACHABLE;
+}
+
+template<DeltaBitpackingType T>
+uint64_t DeltaBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::DELTA_BITPACKING);
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    const auto values = reinterpret_cast<const U*>(srcBuffer);
+    const auto packedMetadata = getPackedMetadata(metadata);
+    const auto minDelta = static_cast<U>(metadata.getChild(DELTA_CHILD_IDX).min.get<S>());
+    const auto blockSizeInBytes = getBlockSizeInBytes(getBitWidth(metadata));
+    std::vector<U> deltas(BLOCK_SIZE - 1);
+    uint64_t compressedSize = 0;
+    for (uint64_t blockStart = 0; blockStart < numValuesToCompress; blockStart += BLOCK_SIZE) {
+        const auto blockValues = values + blockStart;
+        const auto numDeltas = std::min(BLOCK_SIZE, numValuesToCompress - blockStart) - 1;
+        // Blocks have a fixed size, even though the differences of a full block take less space.
+        const auto block = dstBuffer + blockStart / BLOCK_SIZE * blockSizeInBytes;
+        memcpy(block, blockValues, sizeof(U));
+        compressedSize = block - dstBuffer + sizeof(U);
+        if (numDeltas == 0) {
+            continue;
+        }
+        for (auto i = 1u; i <= numDeltas; i++) {
+            deltas[i - 1] = blockValues[i] - blockValues[i - 1] - minDelta;
+        }
+        auto deltaBuffer = reinterpret_cast<const uint8_t*>(deltas.data());
+        // The last block of a full page is smaller, but numValues only fills it with as many
+        // differences as fit.
+        compressedSize += IntegerBitpacking<U>().compressNextPage(deltaBuffer, numDeltas,
+            block + sizeof(U), blockSizeInBytes - sizeof(U), packedMetadata);
+        KU_ASSERT(deltaBuffer == reinterpret_cast<const uint8_t*>(deltas.data() + numDeltas));
+    }
+    srcBuffer += numValuesToCompress * sizeof(U);
+    return compressedSize;
+}
+
+template<DeltaBitpackingType T>
+void DeltaBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    // Multiple of the bitpacking chunk size, so the differences are always unpacked from aligned
+    // chunks.
+    static constexpr uint64_t BATCH_SIZE = 4 * IntegerBitpacking<U>::CHUNK_SIZE;
+    static_assert(BLOCK_SIZE % BATCH_SIZE == 0);
+    const auto packedMetadata = getPackedMetadata(metadata);
+    const auto packedBitWidth = IntegerBitpacking<U>::getPackingInfo(packedMetadata).bitWidth;
+    const auto blockSizeInBytes = getBlockSizeInBytes(packedBitWidth);
+    const auto minDelta = static_cast<U>(metadata.getChild(DELTA_CHILD_IDX).min.get<S>());
+    const auto result = reinterpret_cast<U*>(dstBuffer) + dstOffset;
+    // The value at position i is the first value of its block plus the differences up to i, so
+    // at most one block is decoded before the first requested value.
+    U deltas[BATCH_SIZE]{};
+    const auto endOffset = srcOffset + numValues;
+    for (auto blockStart = srcOffset / BLOCK_SIZE * BLOCK_SIZE; blockStart < endOffset;
+         blockStart += BLOCK_SIZE) {
+        const auto block = srcBuffer + blockStart / BLOCK_SIZE * blockSizeInBytes;
+        U value = 0;
+        memcpy(&value, block, sizeof(U));
+        if (blockStart >= srcOffset) {
+            result[blockStart - srcOffset] = value;
+        }
+        const auto blockEnd = std::min(blockStart + BLOCK_SIZE, endOffset);
+        for (auto pos = blockStart + 1; pos < blockEnd; pos += BATCH_SIZE) {
+            const auto batchSize = std::min(BATCH_SIZE, blockEnd - pos);
+            if (packedBitWidth > 0) {
+                IntegerBitpacking<U>().decompressFromPage(block + sizeof(U), pos - blockStart - 1,
+                    reinterpret_cast<uint8_t*>(deltas), 0, batchSize, packedMetadata);
+            }
+            for (auto i = 0u; i < batchSize; i++) {
+                value += deltas[i] + minDelta;
+                if (pos + i >= srcOffset) {
+                    result[pos + i - srcOffset] = value;
+                }
+            }
+        }
+    }
+}
+
+template class DeltaBitpacking<int32_t>;
+template class DeltaBitpacking<int64_t>;
+template class DeltaBitpacking<uint32_t>;
+template class DeltaBitpacking<uint64_t>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/, const NullMask* /*nullMask*/) const {
@@ -886,6 +1088,7 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         return constant.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
             posInVector, numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -949,6 +1152,22 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return TypeUtils::visit(
+            physicalType,
+            [&](internalID_t) {
+                DeltaBitpacking<uint64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                    resultVector->getData(), posInVector, numValuesToRead, metadata);
+            },
+            [&]<DeltaBitpackingType T>(T) {
+                DeltaBitpacking<T>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                    resultVector->getData(), posInVector, numValuesToRead, metadata);
+            },
+            [&](auto) {
+                throw NotImplementedException("DELTA_BITPACKING is not implemented for type " +
+                                              PhysicalTypeUtils::toString(physicalType));
+            });
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
@@ -965,6 +1184,7 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         return constant.copyFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
             numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -1028,6 +1248,22 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         }
         }
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return TypeUtils::visit(
+            physicalType,
+            [&](internalID_t) {
+                DeltaBitpacking<uint64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                    result, startPosInResult, numValuesToRead, metadata);
+            },
+            [&]<DeltaBitpackingType T>(T) {
+                DeltaBitpacking<T>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                    result, startPosInResult, numValuesToRead, metadata);
+            },
+            [&](auto) {
+                throw NotImplementedException("DELTA_BITPACKING is not implemented for type " +
+                                              PhysicalTypeUtils::toString(physicalType));
+            });
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
@@ -1045,6 +1281,7 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
         return constant.setValuesFromUncompressed(data, dataOffset, frame, posInFrame, numValues,
             metadata, nullMask);
     case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST:
         return uncompressed.setValuesFromUncompressed(data, dataOffset, frame, posInFrame,
             numValues, metadata, nullMask);
     case CompressionType::INTEGER_BITPACKING: {
@@ -1075,6 +1312,9 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
             }
         });
     }
+    case CompressionType::DELTA_BITPACKING:
+        // Delta bitpacked values are never updated in place.
+        KU_UNREACHABLE;
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.copyFromPage(data, dataOffset, frame, posInFrame, numValues,
             metadata);
@@ -0,0 +1,174 @@
+#include "storage/compression/fsst.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+namespace kuzu {
+namespace storage {
+
+// Number of bytes of string data the symbol table is trained on.
+static constexpr uint64_t SAMPLE_SIZE = 16 * 1024;
+// Number of rounds used to refine the symbol table.
+static constexpr uint64_t NUM_BUILD_ROUNDS = 5;
+
+static std::vector<std::string_view> sampleStrings(const std::vector<std::string_view>& strings) {
+    uint64_t totalSize = 0;
+    for (auto& str : strings) {
+        totalSize += str.size();
+    }
+    if (totalSize <= SAMPLE_SIZE) {
+        return strings;
+    }
+    // Take every n-th string, so the sample covers the whole input.
+    const auto stride = (totalSize + SAMPLE_SIZE - 1) / SAMPLE_SIZE;
+    std::vector<std::string_view> sample;
+    for (auto i = 0u; i < strings.size(); i += stride) {
+        sample.push_back(strings[i]);
+    }
+    return sample;
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& strings) {
+    const auto sample = sampleStrings(strings);
+    FSSTSymbolTable table;
+    for (auto round = 0u; round < NUM_BUILD_ROUNDS; round++) {
+        // Compress the sample with the current table and count how often each symbol, and each
+        // concatenation of two adjacent symbols, occurs. Escaped bytes count as one-byte symbols.
+        std::unordered_map<std::string, uint64_t> counts;
+        for (auto& str : sample) {
+            auto data = reinterpret_cast<const uint8_t*>(str.data());
+            std::string_view prev;
+            uint64_t pos = 0;
+            while (pos < str.size()) {
+                const auto code = table.findLongestSymbol(data + pos, str.size() - pos);
+                const auto length = code == ESCAPE_CODE ? 1 : table.symbols[code].length;
+                const auto cur = str.substr(pos, length);
+                counts[std::string(cur)]++;
+                if (!prev.empty() && prev.size() + cur.size() <= MAX_SYMBOL_LENGTH) {
+                    counts[std::string(prev) + std::string(cur)]++;
+                }
+                prev = cur;
+                pos += length;
+            }
+        }
+        // Keep the symbols which cover the most bytes of the sample.
+        std::vector<std::pair<uint64_t, std::string>> candidates;
+        candidates.reserve(counts.size());
+        for (auto& [symbol, count] : counts) {
+            candidates.emplace_back(count * symbol.size(), symbol);
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+            return a.first > b.first || (a.first == b.first && a.second < b.second);
+        });
+        table = FSSTSymbolTable{};
+        for (auto i = 0u; i < std::min<uint64_t>(candidates.size(), MAX_NUM_SYMBOLS); i++) {
+            auto& symbolStr = candidates[i].second;
+            Symbol symbol{};
+            memcpy(symbol.bytes.data(), symbolStr.data(), symbolStr.size());
+            symbol.length = symbolStr.size();
+            table.addSymbol(symbol);
+        }
+    }
+    return table;
+}
+
+void FSSTSymbolTable::addSymbol(const Symbol& symbol) {
+    KU_ASSERT(symbols.size() < MAX_NUM_SYMBOLS);
+    KU_ASSERT(symbol.length > 0 && symbol.length <= MAX_SYMBOL_LENGTH);
+    const auto code = static_cast<uint8_t>(symbols.size());
+    symbols.push_back(symbol);
+    auto& codes = codesByFirstByte[symbol.bytes[0]];
+    auto it = std::find_if(codes.begin(), codes.end(),
+        [&](uint8_t other) { return symbols[other].length < symbol.length; });
+    codes.insert(it, code);
+}
+
+uint8_t FSSTSymbolTable::findLongestSymbol(const uint8_t* data, uint64_t length) const {
+    KU_ASSERT(length > 0);
+    for (auto code : codesByFirstByte[data[0]]) {
+        auto& symbol = symbols[code];
+        if (symbol.length <= length && memcmp(symbol.bytes.data(), data, symbol.length) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+void FSSTSymbolTable::compress(std::string_view str, std::vector<uint8_t>& result) const {
+    auto data = reinterpret_cast<const uint8_t*>(str.data());
+    uint64_t pos = 0;
+    while (pos < str.size()) {
+        const auto code = findLongestSymbol(data + pos, str.size() - pos);
+        result.push_back(code);
+        if (code == ESCAPE_CODE) {
+            result.push_back(data[pos]);
+            pos++;
+        } else {
+            pos += symbols[code].length;
+        }
+    }
+}
+
+uint64_t FSSTSymbolTable::getDecompressedLength(const uint8_t* data, uint64_t length) const {
+    uint64_t result = 0;
+    uint64_t pos = 0;
+    while (pos < length) {
+        const auto code = data[pos];
+        if (code == ESCAPE_CODE) {
+            result++;
+            pos += 2;
+        } else {
+            KU_ASSERT(code < symbols.size());
+            result += symbols[code].length;
+            pos++;
+        }
+    }
+    return result;
+}
+
+void FSSTSymbolTable::decompress(const uint8_t* data, uint64_t length, uint8_t* result) const {
+    uint64_t pos = 0;
+    while (pos < length) {
+        const auto code = data[pos];
+        if (code == ESCAPE_CODE) {
+            KU_ASSERT(pos + 1 < length);
+            *result++ = data[pos + 1];
+            pos += 2;
+        } else {
+            auto& symbol = symbols[code];
+            memcpy(result, symbol.bytes.data(), symbol.length);
+            result += symbol.length;
+            pos++;
+        }
+    }
+}
+
+void FSSTSymbolTable::serialize(common::Serializer& serializer) const {
+    serializer.write<uint64_t>(symbols.size());
+    for (auto& symbol : symbols) {
+        serializer.write(symbol.length);
+        serializer.write(symbol.bytes.data(), symbol.length);
+    }
+}
+
+FSSTSymbolTable FSSTSymbolTable::deserialize(common::Deserializer& deserializer) {
+    FSSTSymbolTable table;
+    uint64_t numSymbols = 0;
+    deserializer.deserializeValue(numSymbols);
+    for (auto i = 0u; i < numSymbols; i++) {
+        Symbol symbol{};
+        deserializer.deserializeValue(symbol.length);
+        deserializer.read(symbol.bytes.data(), symbol.length);
+        table.addSymbol(symbol);
+    }
+    return table;
+}
+
+} // namespace storage
+} // namespace kuzu
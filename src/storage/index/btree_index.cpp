@@ -0,0 +1,730 @@
+#include "storage/index/btree_index.h"
+
+#include <functional>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <span>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/data_chunk/data_chunk_state.h"
+#include "common/mask.h"
+#include "common/serializer/buffer_writer.h"
+#include "common/serializer/deserializer.h"
+#include "common/type_utils.h"
+#include "common/utils.h"
+#include "main/client_context.h"
+#include "storage/file_handle.h"
+#include "storage/page_allocator.h"
+#include "storage/shadow_file.h"
+#include "storage/shadow_utils.h"
+#include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+std::shared_ptr<BufferWriter> BTreeIndexStorageInfo::serialize() const {
+    auto bufferWriter = std::make_shared<BufferWriter>();
+    auto serializer = Serializer(bufferWriter);
+    serializer.write<page_idx_t>(rootPageIdx);
+    serializer.write<uint64_t>(height);
+    serializer.write<uint64_t>(numEntries);
+    serializer.write<offset_t>(numIndexedRows);
+    return bufferWriter;
+}
+
+std::unique_ptr<IndexStorageInfo> BTreeIndexStorageInfo::deserialize(
+    std::unique_ptr<BufferReader> reader) {
+    page_idx_t rootPageIdx = INVALID_PAGE_IDX;
+    uint64_t height = 0;
+    uint64_t numEntries = 0;
+    offset_t numIndexedRows = 0;
+    Deserializer deSer(std::move(reader));
+    deSer.deserializeValue(rootPageIdx);
+    deSer.deserializeValue(height);
+    deSer.deserializeValue(numEntries);
+    deSer.deserializeValue(numIndexedRows);
+    return std::make_unique<BTreeIndexStorageInfo>(rootPageIdx, height, numEntries,
+        numIndexedRows);
+}
+
+// Reads the key of single rows of the indexed table.
+struct BTreeKeyReader {
+    NodeTable& table;
+    std::shared_ptr<DataChunkState> state;
+    ValueVector nodeIDVector;
+    ValueVector keyVector;
+    NodeTableScanState scanState;
+
+    BTreeKeyReader(const Transaction* transaction, NodeTable& table, column_id_t columnID,
+        MemoryManager* mm)
+        : table{table}, state{DataChunkState::getSingleValueDataChunkState()},
+          nodeIDVector{LogicalType::INTERNAL_ID(), mm, state},
+          keyVector{table.getColumn(columnID).getDataType().copy(), mm, state},
+          scanState{&nodeIDVector, std::vector{&keyVector}, state} {
+        scanState.setToTable(transaction, &table, {columnID}, {});
+    }
+
+    sel_t getKeyPos() const { return state->getSelVector()[0]; }
+
+    // Returns false if the row doesn't exist for the transaction or its key is NULL.
+    bool read(Transaction* transaction, offset_t offset) {
+        if (offset >= table.getNumTotalRows(transaction)) {
+            return false;
+        }
+        nodeIDVector.setValue<nodeID_t>(getKeyPos(), nodeID_t{offset, table.getTableID()});
+        table.initScanState(transaction, scanState, table.getTableID(), offset);
+        return table.lookup(transaction, scanState) && !keyVector.isNull(getKeyPos());
+    }
+};
+
+template<BTreeIndexKey T>
+struct BTreeLeafPage {
+    static constexpr uint64_t CAPACITY =
+        (KUZU_PAGE_SIZE - sizeof(uint64_t)) / (sizeof(offset_t) + sizeof(T));
+
+    uint64_t numEntries;
+    offset_t offsets[CAPACITY];
+    T keys[CAPACITY];
+};
+
+template<BTreeIndexKey T>
+struct BTreeInternalPage {
+    static constexpr uint64_t CAPACITY = (KUZU_PAGE_SIZE - sizeof(uint64_t)) /
+                                         (sizeof(offset_t) + sizeof(T) + sizeof(page_idx_t));
+
+    uint64_t numEntries;
+    // Each child only holds entries that are not smaller than its separator (key, offset) and
+    // smaller than the separator of the next child. The separator of the first child is unused.
+    offset_t offsets[CAPACITY];
+    T keys[CAPACITY];
+    page_idx_t children[CAPACITY];
+};
+
+template<BTreeIndexKey T>
+struct BTreeKeyRange {
+    std::optional<T> lower;
+    std::optional<T> upper;
+    bool lowerInclusive = true;
+    bool upperInclusive = true;
+
+    bool isBelow(T key) const {
+        return lower.has_value() && (key < *lower || (!lowerInclusive && key == *lower));
+    }
+    bool isAbove(T key) const {
+        return upper.has_value() && (key > *upper || (!upperInclusive && key == *upper));
+    }
+};
+
+// Returns false if the bound is NULL.
+template<BTreeIndexKey T>
+static bool readBound(const BTreeKeyBound& bound, std::optional<T>& key, bool& inclusive) {
+    if (bound.vector == nullptr) {
+        return true;
+    }
+    const auto pos = bound.vector->state->getSelVector()[0];
+    if (bound.vector->isNull(pos)) {
+        return false;
+    }
+    key = bound.vector->getValue<T>(pos);
+    inclusive = bound.inclusive;
+    return true;
+}
+
+template<BTreeIndexKey T>
+class BTree final : public OnDiskBTree {
+    using entry_t = std::pair<T, offset_t>;
+    using leaf_page_t = BTreeLeafPage<T>;
+    using internal_page_t = BTreeInternalPage<T>;
+    static_assert(sizeof(leaf_page_t) <= KUZU_PAGE_SIZE);
+    static_assert(sizeof(internal_page_t) <= KUZU_PAGE_SIZE);
+
+    // A node and the separator of its entries in the parent.
+    struct NodeRef {
+        entry_t separator;
+        page_idx_t pageIdx;
+    };
+    struct Change {
+        entry_t entry;
+        bool isInsertion;
+
+        bool operator<(const entry_t& other) const { return entry < other; }
+    };
+    // Fills the page with the items in [startIdx, startIdx + numItems) and returns the separator
+    // of the node.
+    using fill_page_func_t = std::function<entry_t(uint64_t, uint64_t, uint8_t*)>;
+
+public:
+    BTree(FileHandle* dataFH, ShadowFile& shadowFile, BTreeIndexStorageInfo& storageInfo)
+        : dataFH{dataFH}, shadowFile{shadowFile}, storageInfo{storageInfo} {}
+
+    void insert(const ValueVector& keyVector, sel_t pos, offset_t offset) override {
+        std::unique_lock lck{mtx};
+        localEntries.emplace(keyVector.getValue<T>(pos), offset);
+    }
+
+    void markForCheck(const ValueVector& keyVector, sel_t pos, offset_t offset,
+        bool insert) override {
+        const entry_t entry{keyVector.getValue<T>(pos), offset};
+        std::unique_lock lck{mtx};
+        if (insert) {
+            localEntries.insert(entry);
+        }
+        uncheckedEntries.insert(entry);
+    }
+
+    void lookup(const BTreeKeyBound& lower, const BTreeKeyBound& upper,
+        std::vector<offset_t>& result) const override;
+
+    void removeStaleEntries(BTreeKeyReader& reader) override;
+
+    bool checkpoint(PageAllocator& pageAllocator) override;
+
+    void reclaimStorage(PageAllocator& pageAllocator) const override {
+        if (storageInfo.rootPageIdx != INVALID_PAGE_IDX) {
+            const auto buffer = std::make_unique<uint8_t[]>(KUZU_PAGE_SIZE);
+            reclaimNode(pageAllocator, storageInfo.rootPageIdx, storageInfo.height, buffer.get());
+        }
+    }
+
+private:
+    void readPage(page_idx_t pageIdx, uint8_t* buffer) const {
+        dataFH->optimisticReadPage(pageIdx,
+            [&](const uint8_t* frame) { memcpy(buffer, frame, KUZU_PAGE_SIZE); });
+    }
+    // Pages updated by the ongoing checkpoint are only in the shadow file.
+    void readPageInCheckpoint(page_idx_t pageIdx, uint8_t* buffer) const {
+        if (shadowFile.hasShadowPage(dataFH->getFileIndex(), pageIdx)) {
+            ShadowUtils::readShadowVersionOfPage(*dataFH, pageIdx, shadowFile,
+                [&](const uint8_t* frame) { memcpy(buffer, frame, KUZU_PAGE_SIZE); });
+        } else {
+            readPage(pageIdx, buffer);
+        }
+    }
+
+    void lookupInNode(page_idx_t pageIdx, uint64_t level, const BTreeKeyRange<T>& range,
+        uint8_t* buffer, std::vector<offset_t>& result) const;
+
+    void reclaimNode(PageAllocator& pageAllocator, page_idx_t pageIdx, uint64_t level,
+        uint8_t* buffer) const;
+
+    // Applies the changes to the node and returns the nodes replacing it in its parent, which is
+    // none if it became empty, or several if it had to be split.
+    std::vector<NodeRef> mergeIntoNode(PageAllocator& pageAllocator, page_idx_t pageIdx,
+        uint64_t level, std::span<const Change> changes, uint8_t* buffer);
+    std::vector<NodeRef> mergeIntoLeaf(PageAllocator& pageAllocator, page_idx_t pageIdx,
+        std::span<const Change> changes, uint8_t* buffer);
+    std::vector<NodeRef> mergeIntoInternal(PageAllocator& pageAllocator, page_idx_t pageIdx,
+        uint64_t level, std::span<const Change> changes, uint8_t* buffer);
+
+    // Writes the items into as few nodes as possible. The first node reuses `pageIdx` if it is
+    // valid, whose page is freed if there are no items.
+    std::vector<NodeRef> writeNodes(PageAllocator& pageAllocator, page_idx_t pageIdx,
+        uint64_t numItems, uint64_t capacity, const fill_page_func_t& fillPage, uint8_t* buffer);
+    std::vector<NodeRef> writeInternalNodes(PageAllocator& pageAllocator, page_idx_t pageIdx,
+        const std::vector<NodeRef>& children, uint8_t* buffer);
+
+private:
+    FileHandle* dataFH;
+    ShadowFile& shadowFile;
+    BTreeIndexStorageInfo& storageInfo;
+    mutable std::shared_mutex mtx;
+    // Entries committed since the last checkpoint.
+    std::set<entry_t> localEntries;
+    // Entries of updated or deleted rows, to be checked before the next checkpoint.
+    std::set<entry_t> uncheckedEntries;
+    // Entries whose rows no longer hold their key, to be removed by the next checkpoint.
+    std::set<entry_t> staleEntries;
+};
+
+template<BTreeIndexKey T>
+void BTree<T>::lookupInNode(page_idx_t pageIdx, uint64_t level, const BTreeKeyRange<T>& range,
+    uint8_t* buffer, std::vector<offset_t>& result) const {
+    readPage(pageIdx, buffer);
+    if (level == 0) {
+        const auto& leaf = *reinterpret_cast<const leaf_page_t*>(buffer);
+        const auto* keysEnd = leaf.keys + leaf.numEntries;
+        const auto* key = range.lower.has_value() ?
+                              std::lower_bound(leaf.keys, keysEnd, *range.lower) :
+                              leaf.keys;
+        for (; key != keysEnd && !range.isAbove(*key); key++) {
+            if (!range.isBelow(*key)) {
+                result.push_back(leaf.offsets[key - leaf.keys]);
+            }
+        }
+        return;
+    }
+    const auto& node = *reinterpret_cast<const internal_page_t*>(buffer);
+    KU_ASSERT(node.numEntries > 0);
+    // Entries with the same key may span multiple children, so the children are only skipped if
+    // their separators rule out all keys in the range.
+    const auto* separatorsEnd = node.keys + node.numEntries;
+    uint64_t firstChild = 0;
+    if (range.lower.has_value()) {
+        firstChild = std::lower_bound(node.keys + 1, separatorsEnd, *range.lower) - node.keys - 1;
+    }
+    uint64_t endChild = node.numEntries;
+    if (range.upper.has_value()) {
+        endChild = std::upper_bound(node.keys + 1, separatorsEnd, *range.upper) - node.keys;
+    }
+    if (firstChild >= endChild) {
+        return;
+    }
+    // The buffer is reused by the children.
+    const std::vector<page_idx_t> children(node.children + firstChild, node.children + endChild);
+    for (const auto child : children) {
+        lookupInNode(child, level - 1, range, buffer, result);
+    }
+}
+
+template<BTreeIndexKey T>
+void BTree<T>::lookup(const BTreeKeyBound& lower, const BTreeKeyBound& upper,
+    std::vector<offset_t>& result) const {
+    BTreeKeyRange<T> range;
+    if (!readBound(lower, range.lower, range.lowerInclusive) ||
+        !readBound(upper, range.upper, range.upperInclusive)) {
+        // Comparisons with NULL never evaluate to true.
+        return;
+    }
+    if (storageInfo.rootPageIdx != INVALID_PAGE_IDX) {
+        const auto buffer = std::make_unique<uint8_t[]>(KUZU_PAGE_SIZE);
+        lookupInNode(storageInfo.rootPageIdx, storageInfo.height, range, buffer.get(), result);
+    }
+    {
+        std::shared_lock lck{mtx};
+        auto it = range.lower.has_value() ? localEntries.lower_bound(entry_t{*range.lower, 0}) :
+                                            localEntries.begin();
+        for (; it != localEntries.end() && !range.isAbove(it->first); ++it) {
+            if (!range.isBelow(it->first)) {
+                result.push_back(it->second);
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+template<BTreeIndexKey T>
+void BTree<T>::reclaimNode(PageAllocator& pageAllocator, page_idx_t pageIdx, uint64_t level,
+    uint8_t* buffer) const {
+    if (level > 0) {
+        readPage(pageIdx, buffer);
+        const auto& node = *reinterpret_cast<const internal_page_t*>(buffer);
+        const std::vector<page_idx_t> children(node.children, node.children + node.numEntries);
+        for (const auto child : children) {
+            reclaimNode(pageAllocator, child, level - 1, buffer);
+        }
+    }
+    pageAllocator.freePageRange(PageRange(pageIdx, 1));
+}
+
+template<BTreeIndexKey T>
+void BTree<T>::removeStaleEntries(BTreeKeyReader& reader) {
+    std::unique_lock lck{mtx};
+    for (const auto& entry : uncheckedEntries) {
+        if (reader.read(&DUMMY_CHECKPOINT_TRANSACTION, entry.second) &&
+            reader.keyVector.getValue<T>(reader.getKeyPos()) == entry.first) {
+            continue;
+        }
+        localEntries.erase(entry);
+        staleEntries.insert(entry);
+    }
+    uncheckedEntries.clear();
+}
+
+template<BTreeIndexKey T>
+std::vector<typename BTree<T>::NodeRef> BTree<T>::writeNodes(PageAllocator& pageAllocator,
+    page_idx_t pageIdx, uint64_t numItems, uint64_t capacity, const fill_page_func_t& fillPage,
+    uint8_t* buffer) {
+    std::vector<NodeRef> nodes;
+    if (numItems == 0) {
+        if (pageIdx != INVALID_PAGE_IDX) {
+            pageAllocator.freePageRange(PageRange(pageIdx, 1));
+        }
+        return nodes;
+    }
+    // Items are spread evenly over the nodes, so that split nodes have room for later insertions.
+    const auto numNodes = ceilDiv(numItems, capacity);
+    for (auto i = 0u; i < numNodes; i++) {
+        const auto startIdx = numItems * i / numNodes;
+        const auto endIdx = numItems * (i + 1) / numNodes;
+        memset(buffer, 0, KUZU_PAGE_SIZE);
+        const auto separator = fillPage(startIdx, endIdx - startIdx, buffer);
+        if (i == 0 && pageIdx != INVALID_PAGE_IDX) {
+            // Existing pages are updated through the shadow file, so that the tree of the last
+            // checkpoint stays intact until this one is applied.
+            ShadowUtils::updatePage(*dataFH, pageIdx, true /* skipReadingOriginalPage */,
+                shadowFile, [&](uint8_t* frame) { memcpy(frame, buffer, KUZU_PAGE_SIZE); });
+            nodes.push_back(NodeRef{separator, pageIdx});
+        } else {
+            const auto newPageIdx = pageAllocator.allocatePageRange(1).startPageIdx;
+            dataFH->writePageToFile(buffer, newPageIdx);
+            nodes.push_back(NodeRef{separator, newPageIdx});
+        }
+    }
+    return nodes;
+}
+
+template<BTreeIndexKey T>
+std::vector<typename BTree<T>::NodeRef> BTree<T>::writeInternalNodes(PageAllocator& pageAllocator,
+    page_idx_t pageIdx, const std::vector<NodeRef>& children, uint8_t* buffer) {
+    return writeNodes(pageAllocator, pageIdx, children.size(), internal_page_t::CAPACITY,
+        [&](uint64_t startIdx, uint64_t numItems, uint8_t* page) {
+            auto& node = *reinterpret_cast<internal_page_t*>(page);
+            node.numEntries = numItems;
+            for (auto i = 0u; i < numItems; i++) {
+                const auto& child = children[startIdx + i];
+                node.keys[i] = child.separator.first;
+                node.offsets[i] = child.separator.second;
+                node.children[i] = child.pageIdx;
+            }
+            return children[startIdx].separator;
+        },
+        buffer);
+}
+
+template<BTreeIndexKey T>
+std::vector<typename BTree<T>::NodeRef> BTree<T>::mergeIntoNode(PageAllocator& pageAllocator,
+    page_idx_t pageIdx, uint64_t level, std::span<const Change> changes, uint8_t* buffer) {
+    return level == 0 ? mergeIntoLeaf(pageAllocator, pageIdx, changes, buffer) :
+                        mergeIntoInternal(pageAllocator, pageIdx, level, changes, buffer);
+}
+
+template<BTreeIndexKey T>
+std::vector<typename BTree<T>::NodeRef> BTree<T>::mergeIntoLeaf(PageAllocator& pageAllocator,
+    page_idx_t pageIdx, std::span<const Change> changes, uint8_t* buffer) {
+    std::vector<entry_t> entries;
+    auto change = changes.begin();
+    const auto applyChangesBelow = [&](const entry_t* entry) {
+        for (; change != changes.end() && (entry == nullptr || change->entry < *entry); ++change) {
+            if (change->isInsertion) {
+                entries.push_back(change->entry);
+                storageInfo.numEntries++;
+            }
+        }
+    };
+    if (pageIdx != INVALID_PAGE_IDX) {
+        readPageInCheckpoint(pageIdx, buffer);
+        const auto& leaf = *reinterpret_cast<const leaf_page_t*>(buffer);
+        entries.reserve(leaf.numEntries + changes.size());
+        for (auto i = 0u; i < leaf.numEntries; i++) {
+            const entry_t entry{leaf.keys[i], leaf.offsets[i]};
+            applyChangesBelow(&entry);
+            if (change != changes.end() && change->entry == entry) {
+                // Insertions of existing entries are no-ops.
+                if (!(change++)->isInsertion) {
+                    storageInfo.numEntries--;
+                    continue;
+                }
+            }
+            entries.push_back(entry);
+        }
+    }
+    applyChangesBelow(nullptr);
+    return writeNodes(pageAllocator, pageIdx, entries.size(), leaf_page_t::CAPACITY,
+        [&](uint64_t startIdx, uint64_t numItems, uint8_t* page) {
+            auto& leaf = *reinterpret_cast<leaf_page_t*>(page);
+            leaf.numEntries = numItems;
+            for (auto i = 0u; i < numItems; i++) {
+                leaf.keys[i] = entries[startIdx + i].first;
+                leaf.offsets[i] = entries[startIdx + i].second;
+            }
+            return entries[startIdx];
+        },
+        buffer);
+}
+
+template<BTreeIndexKey T>
+std::vector<typename BTree<T>::NodeRef> BTree<T>::mergeIntoInternal(PageAllocator& pageAllocator,
+    page_idx_t pageIdx, uint64_t level, std::span<const Change> changes, uint8_t* buffer) {
+    readPageInCheckpoint(pageIdx, buffer);
+    std::vector<NodeRef> children;
+    {
+        const auto& node = *reinterpret_cast<const internal_page_t*>(buffer);
+        children.reserve(node.numEntries);
+        for (auto i = 0u; i < node.numEntries; i++) {
+            children.push_back(
+                NodeRef{entry_t{node.keys[i], node.offsets[i]}, node.children[i]});
+        }
+    }
+    std::vector<NodeRef> newChildren;
+    newChildren.reserve(children.size());
+    auto change = changes.begin();
+    for (auto i = 0u; i < children.size(); i++) {
+        const auto changesEnd =
+            i + 1 < children.size() ?
+                std::lower_bound(change, changes.end(), children[i + 1].separator) :
+                changes.end();
+        if (change == changesEnd) {
+            newChildren.push_back(children[i]);
+            continue;
+        }
+        const auto mergedChildren = mergeIntoNode(pageAllocator, children[i].pageIdx, level - 1,
+            std::span(change, changesEnd), buffer);
+        newChildren.insert(newChildren.end(), mergedChildren.begin(), mergedChildren.end());
+        change = changesEnd;
+    }
+    return writeInternalNodes(pageAllocator, pageIdx, newChildren, buffer);
+}
+
+template<BTreeIndexKey T>
+bool BTree<T>::checkpoint(PageAllocator& pageAllocator) {
+    std::unique_lock lck{mtx};
+    if (localEntries.empty() && staleEntries.empty()) {
+        return false;
+    }
+    std::vector<Change> changes;
+    changes.reserve(localEntries.size() + staleEntries.size());
+    for (const auto& entry : localEntries) {
+        changes.push_back(Change{entry, true /* isInsertion */});
+    }
+    for (const auto& entry : staleEntries) {
+        changes.push_back(Change{entry, false /* isInsertion */});
+    }
+    // Stale entries have been removed from the local ones, so no entry is changed twice.
+    std::inplace_merge(changes.begin(), changes.begin() + localEntries.size(), changes.end(),
+        [](const Change& a, const Change& b) { return a.entry < b.entry; });
+    // Only the nodes on the paths to the changed entries are rewritten.
+    const auto buffer = std::make_unique<uint8_t[]>(KUZU_PAGE_SIZE);
+    auto nodes = mergeIntoNode(pageAllocator, storageInfo.rootPageIdx, storageInfo.height,
+        changes, buffer.get());
+    auto height = storageInfo.height;
+    while (nodes.size() > 1) {
+        nodes = writeInternalNodes(pageAllocator, INVALID_PAGE_IDX, nodes, buffer.get());
+        height++;
+    }
+    auto rootPageIdx = nodes.empty() ? INVALID_PAGE_IDX : nodes[0].pageIdx;
+    if (nodes.empty()) {
+        height = 0;
+    }
+    // Roots with a single child are removed to keep the tree as low as possible.
+    while (height > 0) {
+        readPageInCheckpoint(rootPageIdx, buffer.get());
+        const auto& node = *reinterpret_cast<const internal_page_t*>(buffer.get());
+        if (node.numEntries > 1) {
+            break;
+        }
+        pageAllocator.freePageRange(PageRange(rootPageIdx, 1));
+        rootPageIdx = node.children[0];
+        height--;
+    }
+    storageInfo.rootPageIdx = rootPageIdx;
+    storageInfo.height = height;
+    localEntries.clear();
+    staleEntries.clear();
+    return true;
+}
+
+bool BTreeIndex::isSupportedKeyType(PhysicalTypeID physicalType) {
+    bool supported = false;
+    TypeUtils::visit(
+        physicalType, [&]<BTreeIndexKey T>(T) { supported = true; }, [](auto) {});
+    return supported;
+}
+
+BTreeIndex::BTreeIndex(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storageInfo,
+    StorageManager* storageManager)
+    : Index{std::move(indexInfo), std::move(storageInfo)}, storageManager{storageManager} {
+    KU_ASSERT(this->indexInfo.keyDataTypes.size() == 1);
+    auto& btreeStorageInfo = this->storageInfo->cast<BTreeIndexStorageInfo>();
+    TypeUtils::visit(
+        this->indexInfo.keyDataTypes[0],
+        [&]<BTreeIndexKey T>(T) {
+            btree = std::make_unique<BTree<T>>(storageManager->getDataFH(),
+                storageManager->getShadowFile(), btreeStorageInfo);
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+namespace {
+
+struct BTreeUpdateState final : Index::UpdateState {
+    std::unique_ptr<BTreeKeyReader> keyReader;
+
+    explicit BTreeUpdateState(std::unique_ptr<BTreeKeyReader> keyReader)
+        : keyReader{std::move(keyReader)} {}
+};
+
+struct BTreeDeleteState final : Index::DeleteState {
+    std::unique_ptr<BTreeKeyReader> keyReader;
+
+    explicit BTreeDeleteState(std::unique_ptr<BTreeKeyReader> keyReader)
+        : keyReader{std::move(keyReader)} {}
+};
+
+struct BTreeIndexBuilder final : IndexScanHelper {
+    BTreeIndexBuilder(NodeTable* table, Index* index, OnDiskBTree& btree, offset_t startOffset,
+        offset_t endOffset)
+        : IndexScanHelper{table, index}, btree{btree}, scanState{nullptr},
+          semiMask{SemiMaskUtil::createMask(endOffset)} {
+        semiMask->maskRange(startOffset, endOffset);
+        semiMask->enable();
+    }
+
+    std::unique_ptr<NodeTableScanState> initScanState(const Transaction* transaction,
+        DataChunk& dataChunk) override {
+        auto state = IndexScanHelper::initScanState(transaction, dataChunk);
+        state->source = TableScanSource::COMMITTED;
+        state->semiMask = semiMask.get();
+        scanState = state.get();
+        return state;
+    }
+
+    bool processScanOutput(main::ClientContext*, NodeGroupScanResult scanResult,
+        const std::vector<ValueVector*>& scannedVectors) override {
+        if (scanResult == NODE_GROUP_SCAN_EMPTY_RESULT) {
+            return false;
+        }
+        KU_ASSERT(scannedVectors.size() == 1);
+        const auto& keyVector = *scannedVectors[0];
+        const auto startOffset =
+            StorageUtils::getStartOffsetOfNodeGroup(scanState->nodeGroupIdx) + scanResult.startRow;
+        for (auto i = 0u; i < keyVector.state->getSelSize(); i++) {
+            const auto pos = keyVector.state->getSelVector()[i];
+            if (!keyVector.isNull(pos)) {
+                btree.insert(keyVector, pos, startOffset + pos);
+            }
+        }
+        return true;
+    }
+
+    OnDiskBTree& btree;
+    NodeTableScanState* scanState;
+    std::unique_ptr<SemiMask> semiMask;
+};
+
+} // namespace
+
+void BTreeIndex::build(main::ClientContext* context, NodeTable& nodeTable) {
+    auto& btreeStorageInfo = storageInfo->cast<BTreeIndexStorageInfo>();
+    const auto numRows = nodeTable.getNumTotalRows(&DUMMY_CHECKPOINT_TRANSACTION);
+    if (btreeStorageInfo.numIndexedRows >= numRows) {
+        return;
+    }
+    BTreeIndexBuilder builder{&nodeTable, this, *btree, btreeStorageInfo.numIndexedRows, numRows};
+    nodeTable.scanCommittedIndexColumns(context, builder);
+    btreeStorageInfo.numIndexedRows = numRows;
+}
+
+void BTreeIndex::updateNumIndexedRows(offset_t offset) {
+    auto& btreeStorageInfo = storageInfo->cast<BTreeIndexStorageInfo>();
+    btreeStorageInfo.numIndexedRows = std::max(btreeStorageInfo.numIndexedRows, offset + 1);
+}
+
+void BTreeIndex::commitInsert(Transaction*, const ValueVector& nodeIDVector,
+    const std::vector<ValueVector*>& indexVectors, InsertState&) {
+    KU_ASSERT(indexVectors.size() == 1);
+    const auto& keyVector = *indexVectors[0];
+    for (auto i = 0u; i < nodeIDVector.state->getSelSize(); i++) {
+        const auto offset = nodeIDVector.readNodeOffset(nodeIDVector.state->getSelVector()[i]);
+        const auto keyPos = keyVector.state->getSelVector()[i];
+        if (!keyVector.isNull(keyPos)) {
+            btree->insert(keyVector, keyPos, offset);
+        }
+        updateNumIndexedRows(offset);
+    }
+}
+
+std::unique_ptr<BTreeKeyReader> BTreeIndex::initKeyReader(const Transaction* transaction,
+    MemoryManager* mm) const {
+    auto& nodeTable = storageManager->getTable(indexInfo.tableID)->cast<NodeTable>();
+    return std::make_unique<BTreeKeyReader>(transaction, nodeTable, indexInfo.columnIDs[0], mm);
+}
+
+std::unique_ptr<Index::UpdateState> BTreeIndex::initUpdateState(main::ClientContext* context,
+    column_id_t, visible_func) {
+    return std::make_unique<BTreeUpdateState>(
+        initKeyReader(context->getTransaction(), context->getMemoryManager()));
+}
+
+void BTreeIndex::update(Transaction* transaction, const ValueVector& nodeIDVector,
+    ValueVector& propertyVector, UpdateState& updateState) {
+    const auto offset = nodeIDVector.readNodeOffset(nodeIDVector.state->getSelVector()[0]);
+    if (transaction->isUnCommitted(indexInfo.tableID, offset)) {
+        // Uncommitted rows are indexed with their final values when the transaction commits.
+        return;
+    }
+    // The entry of the new value is inserted right away and the one of the old value is kept.
+    // Whichever doesn't match the committed value is removed before the next checkpoint.
+    auto& keyReader = *updateState.cast<BTreeUpdateState>().keyReader;
+    if (keyReader.read(transaction, offset)) {
+        btree->markForCheck(keyReader.keyVector, keyReader.getKeyPos(), offset,
+            false /* insert */);
+    }
+    const auto pos = propertyVector.state->getSelVector()[0];
+    if (!propertyVector.isNull(pos)) {
+        btree->markForCheck(propertyVector, pos, offset, true /* insert */);
+    }
+}
+
+std::unique_ptr<Index::DeleteState> BTreeIndex::initDeleteState(const Transaction* transaction,
+    MemoryManager* mm, visible_func) {
+    return std::make_unique<BTreeDeleteState>(initKeyReader(transaction, mm));
+}
+
+void BTreeIndex::delete_(Transaction* transaction, const ValueVector& nodeIDVector,
+    DeleteState& deleteState) {
+    auto& keyReader = *deleteState.cast<BTreeDeleteState>().keyReader;
+    for (auto i = 0u; i < nodeIDVector.state->getSelSize(); i++) {
+        const auto offset = nodeIDVector.readNodeOffset(nodeIDVector.state->getSelVector()[i]);
+        if (keyReader.read(transaction, offset)) {
+            btree->markForCheck(keyReader.keyVector, keyReader.getKeyPos(), offset,
+                false /* insert */);
+        }
+    }
+}
+
+void BTreeIndex::prepareCheckpoint(main::ClientContext* context) {
+    const auto keyReader =
+        initKeyReader(&DUMMY_CHECKPOINT_TRANSACTION, context->getMemoryManager());
+    btree->removeStaleEntries(*keyReader);
+}
+
+void BTreeIndex::checkpoint(main::ClientContext*, PageAllocator& pageAllocator) {
+    btree->checkpoint(pageAllocator);
+}
+
+void BTreeIndex::finalize(main::ClientContext* context) {
+    // Rows copied in bulk bypass the commit path, so they are indexed here.
+    auto& nodeTable = context->getStorageManager()->getTable(indexInfo.tableID)->cast<NodeTable>();
+    build(context, nodeTable);
+}
+
+std::unique_ptr<Index> BTreeIndex::load(main::ClientContext*, StorageManager* storageManager,
+    IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
+    auto storageInfoBufferReader =
+        std::make_unique<BufferReader>(storageInfoBuffer.data(), storageInfoBuffer.size());
+    auto storageInfo = BTreeIndexStorageInfo::deserialize(std::move(storageInfoBufferReader));
+    return std::make_unique<BTreeIndex>(std::move(indexInfo), std::move(storageInfo),
+        storageManager);
+}
+
+void BTreeIndex::loadCatalogEntries(const catalog::Catalog& catalog) {
+    for (auto indexEntry : catalog.getIndexEntries(&DUMMY_TRANSACTION)) {
+        if (indexEntry->getIndexType() == TYPE_NAME && !indexEntry->isLoaded()) {
+            indexEntry->setAuxInfo(std::make_unique<BTreeIndexAuxInfo>());
+        }
+    }
+}
+
+std::string BTreeIndexAuxInfo::toCypher(const catalog::IndexCatalogEntry& indexEntry,
+    const catalog::ToCypherInfo& info) const {
+    auto& indexToCypherInfo = info.constCast<catalog::IndexToCypherInfo>();
+    auto catalog = indexToCypherInfo.context->getCatalog();
+    auto tableEntry = catalog->getTableCatalogEntry(indexToCypherInfo.context->getTransaction(),
+        indexEntry.getTableID());
+    KU_ASSERT(indexEntry.getPropertyIDs().size() == 1);
+    auto propertyName = tableEntry->getProperty(indexEntry.getPropertyIDs()[0]).getName();
+    return stringFormat("CALL CREATE_BTREE_INDEX('{}', '{}', '{}');", tableEntry->getName(),
+        indexEntry.getIndexName(), propertyName);
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "common/data_chunk/sel_vector.h"
 #include "storage/predicate/constant_predicate.h"
 #include "storage/predicate/null_predicate.h"
 
@@ -20,6 +21,15 @@ ZoneMapCheckResult ColumnPredicateSet::checkZoneMap(const MergedColumnChunkStats
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+void ColumnPredicateSet::filter(const ValueVector& vector, SelectionVector& selVector) const {
+    for (auto& predicate : predicates) {
+        if (selVector.getSelSize() == 0) {
+            return;
+        }
+        predicate->filter(vector, selVector);
+    }
+}
+
 std::string ColumnPredicateSet::toString() const {
     if (predicates.empty()) {
         return {};
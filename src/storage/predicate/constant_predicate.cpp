@@ -1,6 +1,7 @@
 #include "storage/predicate/constant_predicate.h"
 
 #include "common/type_utils.h"
+#include "common/vector/value_vector.h"
 #include "function/comparison/comparison_functions.h"
 #include "storage/compression/compression.h"
 #include "storage/table/column_chunk_stats.h"
@@ -74,6 +75,59 @@ ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(
         [&](auto) { return ZoneMapCheckResult::ALWAYS_SCAN; });
 }
 
+template<typename T, typename OP>
+static void filterValues(const ValueVector& vector, SelectionVector& selVector, T constant) {
+    const auto values = reinterpret_cast<const T*>(vector.getData());
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    // Null values never satisfy a comparison.
+    selVector.forEach([&](auto pos) {
+        buffer[numSelected] = pos;
+        numSelected += !vector.isNull(pos) && OP::template operation<T>(values[pos], constant);
+    });
+    selVector.setToFiltered(numSelected);
+}
+
+template<typename T>
+static void filterSwitch(const ValueVector& vector, SelectionVector& selVector,
+    ExpressionType expressionType, const Value& value) {
+    const auto constant = value.getValue<T>();
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        filterValues<T, Equals>(vector, selVector, constant);
+    } break;
+    case ExpressionType::NOT_EQUALS: {
+        filterValues<T, NotEquals>(vector, selVector, constant);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        filterValues<T, GreaterThan>(vector, selVector, constant);
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        filterValues<T, GreaterThanEquals>(vector, selVector, constant);
+    } break;
+    case ExpressionType::LESS_THAN: {
+        filterValues<T, LessThan>(vector, selVector, constant);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        filterValues<T, LessThanEquals>(vector, selVector, constant);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void ColumnConstantPredicate::filter(const ValueVector& vector, SelectionVector& selVector) const {
+    // The predicate may be on a cast of the column, in which case the scanned values cannot be
+    // compared with the constant directly.
+    if (value.isNull() || vector.dataType != value.getDataType()) {
+        return;
+    }
+    TypeUtils::visit(
+        vector.dataType.getPhysicalType(),
+        [&]<StorageValueType T>(T) { filterSwitch<T>(vector, selVector, expressionType, value); },
+        [&](auto) {});
+}
+
 std::string ColumnConstantPredicate::toString() {
     std::string valStr;
     if (value.getDataType().getPhysicalType() == PhysicalTypeID::STRING ||
@@ -1,5 +1,6 @@
 #include "storage/predicate/null_predicate.h"
 
+#include "common/vector/value_vector.h"
 #include "storage/table/column_chunk_stats.h"
 
 namespace kuzu::storage {
@@ -12,4 +13,16 @@ common::ZoneMapCheckResult ColumnNullPredicate::checkZoneMap(
                          common::ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+void ColumnNullPredicate::filter(const common::ValueVector& vector,
+    common::SelectionVector& selVector) const {
+    const bool keepNulls = expressionType == common::ExpressionType::IS_NULL;
+    auto buffer = selVector.getMutableBuffer();
+    common::sel_t numSelected = 0;
+    selVector.forEach([&](auto pos) {
+        buffer[numSelected] = pos;
+        numSelected += vector.isNull(pos) == keepNulls;
+    });
+    selVector.setToFiltered(numSelected);
+}
+
 } // namespace kuzu::storage
@@ -36,8 +36,14 @@ ShadowFile::ShadowFile(BufferManager& bm, VirtualFileSystem* vfs, const std::str
     KU_ASSERT(vfs);
 }
 
+bool ShadowFile::hasShadowPage(file_idx_t originalFile, page_idx_t originalPage) const {
+    std::unique_lock lck{mtx};
+    return hasShadowPageNoLock(originalFile, originalPage);
+}
+
 void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    std::unique_lock lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         shadowPagesMap.at(originalFile).erase(originalPage);
         if (shadowPagesMap.at(originalFile).empty()) {
             shadowPagesMap.erase(originalFile);
@@ -46,7 +52,8 @@ void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPag
 }
 
 page_idx_t ShadowFile::getOrCreateShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    std::unique_lock lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         return shadowPagesMap[originalFile][originalPage];
     }
     const auto shadowPageIdx = getOrCreateShadowingFH()->addNewPage();
@@ -56,7 +63,8 @@ page_idx_t ShadowFile::getOrCreateShadowPage(file_idx_t originalFile, page_idx_t
 }
 
 page_idx_t ShadowFile::getShadowPage(file_idx_t originalFile, page_idx_t originalPage) const {
-    KU_ASSERT(hasShadowPage(originalFile, originalPage));
+    std::unique_lock lck{mtx};
+    KU_ASSERT(hasShadowPageNoLock(originalFile, originalPage));
     return shadowPagesMap.at(originalFile).at(originalPage);
 }
 
@@ -0,0 +1,223 @@
+#include "storage/stats/column_histogram.h"
+
+#include <algorithm>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
+#include "common/types/value/value.h"
+#include "common/vector/value_vector.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+concept SampledTypes = (std::integral<T> && !std::is_same_v<T, bool>) || std::floating_point<T>;
+
+ColumnHistogram::ColumnHistogram(std::vector<double> sampledValues) : otherFraction{0} {
+    if (sampledValues.empty()) {
+        return;
+    }
+    std::sort(sampledValues.begin(), sampledValues.end());
+    const auto sampleSize = static_cast<double>(sampledValues.size());
+    // Values appearing more than once in the sample are MCV candidates.
+    std::vector<std::pair<double, uint64_t>> candidates;
+    for (auto i = 0u; i < sampledValues.size();) {
+        auto j = i + 1;
+        while (j < sampledValues.size() && sampledValues[j] == sampledValues[i]) {
+            j++;
+        }
+        if (j - i > 1) {
+            candidates.emplace_back(sampledValues[i], j - i);
+        }
+        i = j;
+    }
+    std::sort(candidates.begin(), candidates.end(),
+        [](const auto& a, const auto& b) { return a.second > b.second; });
+    if (candidates.size() > MAX_NUM_MOST_COMMON_VALUES) {
+        candidates.resize(MAX_NUM_MOST_COMMON_VALUES);
+    }
+    for (auto& [value, count] : candidates) {
+        mostCommonValues.emplace_back(value, static_cast<double>(count) / sampleSize);
+    }
+    std::sort(mostCommonValues.begin(), mostCommonValues.end());
+    std::erase_if(sampledValues, [&](double value) {
+        return std::binary_search(mostCommonValues.begin(), mostCommonValues.end(),
+            std::make_pair(value, 0.0),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+    });
+    otherFraction = static_cast<double>(sampledValues.size()) / sampleSize;
+    if (sampledValues.empty()) {
+        return;
+    }
+    for (auto i = 0u; i <= NUM_BUCKETS; i++) {
+        const auto pos = std::min<uint64_t>(i * sampledValues.size() / NUM_BUCKETS,
+            sampledValues.size() - 1);
+        bucketBounds.push_back(sampledValues[pos]);
+    }
+}
+
+double ColumnHistogram::estimateEqualitySelectivity(double value,
+    cardinality_t numDistinctValues) const {
+    for (auto& [mostCommonValue, fraction] : mostCommonValues) {
+        if (mostCommonValue == value) {
+            return fraction;
+        }
+    }
+    if (bucketBounds.empty() || value < bucketBounds.front() || value > bucketBounds.back()) {
+        return 0;
+    }
+    // Non-MCVs are assumed to be uniformly distributed.
+    const auto numOtherValues = std::max<double>(1,
+        static_cast<double>(numDistinctValues) - static_cast<double>(mostCommonValues.size()));
+    return otherFraction / numOtherValues;
+}
+
+double ColumnHistogram::estimateRangeSelectivity(std::optional<double> lowerBound,
+    bool lowerInclusive, std::optional<double> upperBound, bool upperInclusive) const {
+    double selectivity = 0;
+    for (auto& [value, fraction] : mostCommonValues) {
+        const auto aboveLower = !lowerBound.has_value() || value > *lowerBound ||
+                                (lowerInclusive && value == *lowerBound);
+        const auto belowUpper = !upperBound.has_value() || value < *upperBound ||
+                                (upperInclusive && value == *upperBound);
+        if (aboveLower && belowUpper) {
+            selectivity += fraction;
+        }
+    }
+    if (!bucketBounds.empty()) {
+        const auto lower = lowerBound.has_value() ? getFractionBelow(*lowerBound) : 0.0;
+        const auto upper = upperBound.has_value() ? getFractionBelow(*upperBound) : 1.0;
+        selectivity += otherFraction * std::max(0.0, upper - lower);
+    }
+    return std::min(1.0, selectivity);
+}
+
+double ColumnHistogram::getFractionBelow(double value) const {
+    if (value <= bucketBounds.front()) {
+        return 0;
+    }
+    if (value > bucketBounds.back()) {
+        return 1;
+    }
+    // Find the bucket containing the value and interpolate linearly within it.
+    const auto it = std::lower_bound(bucketBounds.begin(), bucketBounds.end(), value);
+    const auto bucketIdx = static_cast<double>(it - bucketBounds.begin() - 1);
+    const auto bucketStart = *(it - 1);
+    const auto bucketEnd = *it;
+    const auto fractionInBucket = (value - bucketStart) / (bucketEnd - bucketStart);
+    return (bucketIdx + fractionInBucket) / NUM_BUCKETS;
+}
+
+// Deterministic pseudo-random numbers keep samples, and thus plans, reproducible.
+static uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+}
+
+bool ColumnSample::isSampled(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::optional<double> ColumnSample::getSampleValue(const Value& value) {
+    if (value.isNull() || !isSampled(value.getDataType().getPhysicalType())) {
+        return std::nullopt;
+    }
+    std::optional<double> result;
+    TypeUtils::visit(
+        value.getDataType().getPhysicalType(),
+        [&]<SampledTypes T>(T) { result = static_cast<double>(value.getValue<T>()); },
+        [](auto) { KU_UNREACHABLE; });
+    return result;
+}
+
+void ColumnSample::update(const ValueVector& vector) {
+    TypeUtils::visit(
+        vector.dataType.getPhysicalType(),
+        [&]<SampledTypes T>(T) {
+            vector.state->getSelVector().forEach([&](auto pos) {
+                if (!vector.isNull(pos)) {
+                    insert(static_cast<double>(vector.getValue<T>(pos)));
+                }
+            });
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+void ColumnSample::insert(double value) {
+    numValues++;
+    if (values.size() < CAPACITY) {
+        values.push_back(value);
+        return;
+    }
+    const auto idx = mix(numValues) % numValues;
+    if (idx < CAPACITY) {
+        values[idx] = value;
+    }
+}
+
+void ColumnSample::merge(const ColumnSample& other) {
+    if (values.size() + other.values.size() <= CAPACITY) {
+        values.insert(values.end(), other.values.begin(), other.values.end());
+        numValues += other.numValues;
+        return;
+    }
+    // Draw from both samples in proportion to the number of values they are drawn from.
+    auto remaining = values;
+    auto otherRemaining = other.values;
+    const auto totalNumValues = numValues + other.numValues;
+    const auto takeRandom = [](std::vector<double>& from, uint64_t seed) {
+        const auto idx = mix(seed) % from.size();
+        const auto value = from[idx];
+        from[idx] = from.back();
+        from.pop_back();
+        return value;
+    };
+    values.clear();
+    while (values.size() < CAPACITY) {
+        const auto seed = totalNumValues + values.size();
+        const auto fromThis = otherRemaining.empty() ||
+                              (!remaining.empty() && mix(seed) % totalNumValues < numValues);
+        values.push_back(
+            fromThis ? takeRandom(remaining, seed + 1) : takeRandom(otherRemaining, seed + 1));
+    }
+    numValues = totalNumValues;
+}
+
+void ColumnSample::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_values");
+    serializer.serializeValue(numValues);
+    serializer.writeDebuggingInfo("values");
+    serializer.serializeVector(values);
+}
+
+ColumnSample ColumnSample::deserialize(Deserializer& deserializer) {
+    ColumnSample sample;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "num_values");
+    deserializer.deserializeValue(sample.numValues);
+    deserializer.validateDebuggingInfo(info, "values");
+    deserializer.deserializeVector(sample.values);
+    return sample;
+}
+
+} // namespace storage
+} // namespace kuzu
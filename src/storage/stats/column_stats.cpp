@@ -1,6 +1,7 @@
 #include "storage/stats/column_stats.h"
 
 #include "function/hash/vector_hash_functions.h"
+#include "storage/storage_version_info.h"
 
 namespace kuzu {
 namespace storage {
@@ -9,6 +10,20 @@ ColumnStats::ColumnStats(const common::LogicalType& dataType) : hashes{nullptr}
     if (!common::LogicalTypeUtils::isNested(dataType)) {
         hll.emplace();
     }
+    if (ColumnSample::isSampled(dataType.getPhysicalType())) {
+        sample.emplace();
+    }
+}
+
+const ColumnHistogram* ColumnStats::getHistogram() const {
+    if (!sample || sample->empty()) {
+        return nullptr;
+    }
+    std::unique_lock lck{histogram->mtx};
+    if (!histogram->histogram) {
+        histogram->histogram = sample->buildHistogram();
+    }
+    return &*histogram->histogram;
 }
 
 void ColumnStats::update(const common::ValueVector* vector) {
@@ -26,6 +41,34 @@ void ColumnStats::update(const common::ValueVector* vector) {
         hashes->state = nullptr;
         hashes->setAllNonNull();
     }
+    if (sample && ColumnSample::isSampled(vector->dataType.getPhysicalType())) {
+        sample->update(*vector);
+        resetHistogram();
+    }
+}
+
+ColumnStats ColumnStats::deserialize(common::Deserializer& deserializer) {
+    ColumnStats columnStats;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "has_hll");
+    bool hasHll = false;
+    deserializer.deserializeValue(hasHll);
+    if (hasHll) {
+        deserializer.validateDebuggingInfo(info, "hll");
+        columnStats.hll = HyperLogLog::deserialize(deserializer);
+    }
+    if (deserializer.getStorageVersion() < StorageVersionInfo::COLUMN_SAMPLE_STORAGE_VERSION) {
+        // Stats of older versions have no sample, so no histogram is built for the column.
+        return columnStats;
+    }
+    deserializer.validateDebuggingInfo(info, "has_sample");
+    bool hasSample = false;
+    deserializer.deserializeValue(hasSample);
+    if (hasSample) {
+        deserializer.validateDebuggingInfo(info, "sample");
+        columnStats.sample = ColumnSample::deserialize(deserializer);
+    }
+    return columnStats;
 }
 
 } // namespace storage
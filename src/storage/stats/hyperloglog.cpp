@@ -8,19 +8,22 @@
 namespace kuzu {
 namespace storage {
 
-common::cardinality_t HyperLogLog::count() const {
+template<common::cardinality_t P>
+common::cardinality_t HyperLogLogSketch<P>::count() const {
     uint32_t c[Q + 2] = {0};
     extractCounts(c);
     return static_cast<common::cardinality_t>(estimateCardinality(c));
 }
 
-void HyperLogLog::merge(const HyperLogLog& other) {
+template<common::cardinality_t P>
+void HyperLogLogSketch<P>::merge(const HyperLogLogSketch& other) {
     for (auto i = 0u; i < M; ++i) {
         update(i, other.k[i]);
     }
 }
 
-void HyperLogLog::extractCounts(uint32_t* c) const {
+template<common::cardinality_t P>
+void HyperLogLogSketch<P>::extractCounts(uint32_t* c) const {
     for (auto i = 0u; i < M; ++i) {
         c[k[i]]++;
     }
@@ -60,7 +63,8 @@ static double HLLTau(double x) {
     return z / 3;
 }
 
-int64_t HyperLogLog::estimateCardinality(const uint32_t* c) {
+template<common::cardinality_t P>
+int64_t HyperLogLogSketch<P>::estimateCardinality(const uint32_t* c) {
     auto z = M * HLLTau((static_cast<double>(M) - c[Q]) / static_cast<double>(M));
 
     for (auto k = Q; k >= 1; --k) {
@@ -73,18 +77,23 @@ int64_t HyperLogLog::estimateCardinality(const uint32_t* c) {
     return llroundl(ALPHA * M * M / z);
 }
 
-void HyperLogLog::serialize(common::Serializer& serializer) const {
+template<common::cardinality_t P>
+void HyperLogLogSketch<P>::serialize(common::Serializer& serializer) const {
     serializer.writeDebuggingInfo("hll_data");
     serializer.serializeArray<uint8_t, M>(k);
 }
 
-HyperLogLog HyperLogLog::deserialize(common::Deserializer& deserializer) {
-    HyperLogLog result;
+template<common::cardinality_t P>
+HyperLogLogSketch<P> HyperLogLogSketch<P>::deserialize(common::Deserializer& deserializer) {
+    HyperLogLogSketch result;
     std::string info;
     deserializer.validateDebuggingInfo(info, "hll_data");
     deserializer.deserializeArray<uint8_t, M>(result.k);
     return result;
 }
 
+template class HyperLogLogSketch<6>;
+template class HyperLogLogSketch<10>;
+
 } // namespace storage
 } // namespace kuzu
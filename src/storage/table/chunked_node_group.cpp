@@ -273,24 +273,47 @@ void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState
         anchorSelVector.setToUnfiltered(numRowsToScan);
     }
 
-    if (anchorSelVector.getSelSize() > 0) {
-        for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
-            const auto columnID = scanState.columnIDs[i];
-            if (columnID == INVALID_COLUMN_ID) {
-                scanState.outputVectors[i]->setAllNull();
-                continue;
-            }
-            if (columnID == ROW_IDX_COLUMN_ID) {
-                for (auto rowIdx = 0u; rowIdx < numRowsToScan; rowIdx++) {
-                    scanState.rowIdxVector->setValue<row_idx_t>(rowIdx,
-                        rowIdx + rowIdxInGroup + startRowIdx);
-                }
-                continue;
+    if (anchorSelVector.getSelSize() == 0) {
+        return;
+    }
+    // Columns with predicates are scanned first and their predicates are evaluated on the scanned
+    // values, so that the remaining columns are not read for vectors without any matching rows.
+    KU_ASSERT(scanState.columnPredicateSets.size() <= scanState.columnIDs.size());
+    std::vector<bool> isScanned(scanState.columnIDs.size(), false);
+    for (auto i = 0u; i < scanState.columnPredicateSets.size(); i++) {
+        const auto columnID = scanState.columnIDs[i];
+        if (scanState.columnPredicateSets[i].isEmpty() || columnID == INVALID_COLUMN_ID ||
+            columnID == ROW_IDX_COLUMN_ID) {
+            continue;
+        }
+        KU_ASSERT(columnID < chunks.size());
+        chunks[columnID]->scan(transaction, nodeGroupScanState.chunkStates[i],
+            *scanState.outputVectors[i], rowIdxInGroup, numRowsToScan);
+        isScanned[i] = true;
+        scanState.columnPredicateSets[i].filter(*scanState.outputVectors[i], anchorSelVector);
+        if (anchorSelVector.getSelSize() == 0) {
+            return;
+        }
+    }
+    for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
+        if (isScanned[i]) {
+            continue;
+        }
+        const auto columnID = scanState.columnIDs[i];
+        if (columnID == INVALID_COLUMN_ID) {
+            scanState.outputVectors[i]->setAllNull();
+            continue;
+        }
+        if (columnID == ROW_IDX_COLUMN_ID) {
+            for (auto rowIdx = 0u; rowIdx < numRowsToScan; rowIdx++) {
+                scanState.rowIdxVector->setValue<row_idx_t>(rowIdx,
+                    rowIdx + rowIdxInGroup + startRowIdx);
             }
-            KU_ASSERT(columnID < chunks.size());
-            chunks[columnID]->scan(transaction, nodeGroupScanState.chunkStates[i],
-                *scanState.outputVectors[i], rowIdxInGroup, numRowsToScan);
+            continue;
         }
+        KU_ASSERT(columnID < chunks.size());
+        chunks[columnID]->scan(transaction, nodeGroupScanState.chunkStates[i],
+            *scanState.outputVectors[i], rowIdxInGroup, numRowsToScan);
     }
 }
 
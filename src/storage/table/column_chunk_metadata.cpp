@@ -104,13 +104,43 @@ page_idx_t ColumnChunkMetadata::getNumDataPages(PhysicalTypeID dataType) const {
     }
 }
 
-ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /*buffer*/,
+namespace {
+uint64_t getNumPagesForCompression(const CompressionMetadata& compMeta, uint64_t capacity,
+    const LogicalType& dataType) {
+    const auto numValuesPerPage = compMeta.numValues(KUZU_PAGE_SIZE, dataType);
+    return numValuesPerPage == UINT64_MAX ?
+               0 :
+               capacity / numValuesPerPage + (capacity % numValuesPerPage == 0 ? 0 : 1);
+}
+
+template<DeltaBitpackingType T>
+std::optional<CompressionMetadata> getDeltaBitpackingMetadata(std::span<const uint8_t> buffer,
+    uint64_t numValues, StorageValue min, StorageValue max) {
+    using U = numeric_utils::MakeUnSignedT<T>;
+    using S = numeric_utils::MakeSignedT<T>;
+    if (numValues < 2) {
+        return std::nullopt;
+    }
+    // Only use deltas if none of them can overflow. Values spanning more than half of the range of
+    // the type are rarely sorted, and the packed deltas would wrap around.
+    if (static_cast<U>(max.get<T>()) - static_cast<U>(min.get<T>()) >
+        static_cast<U>(std::numeric_limits<S>::max())) {
+        return std::nullopt;
+    }
+    KU_ASSERT(buffer.size() >= numValues * sizeof(T));
+    const auto values = std::span(reinterpret_cast<const T*>(buffer.data()), numValues);
+    return DeltaBitpacking<T>::getMetadata(values, min, max);
+}
+} // namespace
+
+ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> buffer,
     uint64_t capacity, uint64_t numValues, StorageValue min, StorageValue max) {
     // For supported types, min and max may be null if all values are null
     // Compression is supported in this case
     // Unsupported types always return a dummy value (where min != max)
     // so that we don't constant compress them
     auto compMeta = CompressionMetadata(min, max, alg->getCompressionType());
+    std::optional<CompressionMetadata> deltaMeta;
     if (alg->getCompressionType() == CompressionType::INTEGER_BITPACKING) {
         TypeUtils::visit(
             dataType.getPhysicalType(),
@@ -122,12 +152,27 @@ ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /
                 }
             },
             [&](auto) {});
+        TypeUtils::visit(
+            dataType.getPhysicalType(),
+            [&](internalID_t) {
+                deltaMeta = getDeltaBitpackingMetadata<uint64_t>(buffer, numValues, min, max);
+            },
+            [&]<DeltaBitpackingType T>(T) {
+                deltaMeta = getDeltaBitpackingMetadata<T>(buffer, numValues, min, max);
+            },
+            [&](auto) {});
+    }
+    auto numPages = getNumPagesForCompression(compMeta, capacity, dataType);
+    // Sorted data, such as CSR offsets or serial keys, is usually much smaller when storing the
+    // differences between values. Since delta bitpacked chunks have to be rewritten on every
+    // update, they are only used if they take at most half as many pages.
+    if (deltaMeta.has_value()) {
+        const auto numDeltaPages = getNumPagesForCompression(*deltaMeta, capacity, dataType);
+        if (numDeltaPages * 2 <= numPages) {
+            compMeta = std::move(*deltaMeta);
+            numPages = numDeltaPages;
+        }
     }
-    const auto numValuesPerPage = compMeta.numValues(KUZU_PAGE_SIZE, dataType);
-    const auto numPages =
-        numValuesPerPage == UINT64_MAX ?
-            0 :
-            capacity / numValuesPerPage + (capacity % numValuesPerPage == 0 ? 0 : 1);
     return ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues, compMeta);
 }
 
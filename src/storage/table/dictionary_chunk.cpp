@@ -4,6 +4,7 @@
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/fsst.h"
 #include "storage/enums/residency_state.h"
 #include <bit>
 
@@ -21,6 +22,31 @@ namespace storage {
 // exactly the node group size (which is always a power of 2), making sure there is always extra
 // space for updates.
 static constexpr uint64_t INITIAL_OFFSET_CHUNK_CAPACITY = 3;
+// Smaller dictionaries are not worth compressing with FSST, since the symbol table is stored in
+// the chunk metadata.
+static constexpr uint64_t MIN_FSST_DATA_SIZE = 4 * KUZU_PAGE_SIZE;
+
+// String data compressed with FSST. The symbol table is flushed as part of the chunk metadata.
+class FSSTStringDataChunk final : public ColumnChunkData {
+public:
+    FSSTStringDataChunk(MemoryManager& mm, uint64_t capacity, FSSTSymbolTable symbolTable)
+        : ColumnChunkData{mm, LogicalType::UINT8(), capacity, false /*enableCompression*/,
+              ResidencyState::IN_MEMORY, false /*hasNullData*/},
+          symbolTable{std::move(symbolTable)} {}
+
+    ColumnChunkMetadata getMetadataToFlush() const override {
+        // The compressed data is stored as is, even if all bytes happen to be identical.
+        auto metadata = ColumnChunkData::getMetadataToFlush();
+        auto compMeta = CompressionMetadata(metadata.compMeta.min, metadata.compMeta.max,
+            CompressionType::FSST);
+        compMeta.extraMetadata = std::make_unique<FSSTMetadata>(symbolTable);
+        return ColumnChunkMetadata(INVALID_PAGE_IDX, getNumPagesForBytes(getBufferSize()),
+            getNumValues(), std::move(compMeta));
+    }
+
+private:
+    FSSTSymbolTable symbolTable;
+};
 
 DictionaryChunk::DictionaryChunk(MemoryManager& mm, uint64_t capacity, bool enableCompression,
     ResidencyState residencyState)
@@ -102,10 +128,86 @@ uint64_t DictionaryChunk::getEstimatedMemoryUsage() const {
 }
 
 void DictionaryChunk::flush(PageAllocator& pageAllocator) {
+    if (auto compressed = compressWithFSST()) {
+        // The index table refers to the uncompressed strings.
+        indexTable.clear();
+        stringDataChunk = std::move(compressed->stringDataChunk);
+        offsetChunk = std::move(compressed->offsetChunk);
+    }
     stringDataChunk->flush(pageAllocator);
     offsetChunk->flush(pageAllocator);
 }
 
+std::unique_ptr<DictionaryChunk> DictionaryChunk::compressWithFSST() const {
+    const auto dataSize = stringDataChunk->getNumValues();
+    if (!enableCompression || stringDataChunk->getResidencyState() != ResidencyState::IN_MEMORY ||
+        dataSize < MIN_FSST_DATA_SIZE) {
+        return nullptr;
+    }
+    const auto numStrings = offsetChunk->getNumValues();
+    std::vector<std::string_view> strings;
+    strings.reserve(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        strings.push_back(getString(i));
+    }
+    auto symbolTable = FSSTSymbolTable::build(strings);
+    std::vector<uint8_t> compressedData;
+    std::vector<string_offset_t> offsets(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        offsets[i] = compressedData.size();
+        symbolTable.compress(strings[i], compressedData);
+    }
+    if (ColumnChunkData::getNumPagesForBytes(compressedData.size()) >=
+        ColumnChunkData::getNumPagesForBytes(dataSize)) {
+        return nullptr;
+    }
+    auto& mm = stringDataChunk->getMemoryManager();
+    auto result = std::make_unique<DictionaryChunk>(mm, numStrings, enableCompression,
+        ResidencyState::IN_MEMORY);
+    result->stringDataChunk = std::make_unique<FSSTStringDataChunk>(mm, compressedData.size(),
+        std::move(symbolTable));
+    memcpy(result->stringDataChunk->getData(), compressedData.data(), compressedData.size());
+    result->stringDataChunk->setNumValues(compressedData.size());
+    result->offsetChunk->resize(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        result->offsetChunk->setValue<string_offset_t>(offsets[i], i);
+    }
+    return result;
+}
+
+void DictionaryChunk::decompressFSST(const FSSTSymbolTable& symbolTable) {
+    const auto numStrings = offsetChunk->getNumValues();
+    const auto compressedSize = stringDataChunk->getNumValues();
+    const auto compressedData = stringDataChunk->getData();
+    std::vector<string_offset_t> offsets(numStrings);
+    uint64_t dataSize = 0;
+    for (auto i = 0u; i < numStrings; i++) {
+        const auto startOffset = offsetChunk->getValue<string_offset_t>(i);
+        const auto endOffset = i + 1 < numStrings ?
+                                   offsetChunk->getValue<string_offset_t>(i + 1) :
+                                   compressedSize;
+        offsets[i] = dataSize;
+        dataSize += symbolTable.getDecompressedLength(compressedData + startOffset,
+            endOffset - startOffset);
+    }
+    auto data = ColumnChunkFactory::createColumnChunkData(stringDataChunk->getMemoryManager(),
+        LogicalType::UINT8(), false /*enableCompression*/, std::bit_ceil(dataSize),
+        ResidencyState::IN_MEMORY, false /*hasNullData*/);
+    for (auto i = 0u; i < numStrings; i++) {
+        const auto startOffset = offsetChunk->getValue<string_offset_t>(i);
+        const auto endOffset = i + 1 < numStrings ?
+                                   offsetChunk->getValue<string_offset_t>(i + 1) :
+                                   compressedSize;
+        symbolTable.decompress(compressedData + startOffset, endOffset - startOffset,
+            data->getData() + offsets[i]);
+    }
+    data->setNumValues(dataSize);
+    for (auto i = 0u; i < numStrings; i++) {
+        offsetChunk->setValue<string_offset_t>(offsets[i], i);
+    }
+    stringDataChunk = std::move(data);
+}
+
 void DictionaryChunk::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("offset_chunk");
     offsetChunk->serialize(serializer);
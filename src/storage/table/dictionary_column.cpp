@@ -5,6 +5,7 @@
 #include "common/types/ku_string.h"
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/compression/fsst.h"
 #include "storage/storage_utils.h"
 #include "storage/table/string_column.h"
 #include <bit>
@@ -48,6 +49,9 @@ void DictionaryColumn::scan(const ChunkState& state, DictionaryChunk& dictChunk)
     }
     offsetColumn->scan(StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET),
         offsetChunk);
+    if (dataMetadata.compMeta.compression == CompressionType::FSST) {
+        dictChunk.decompressFSST(dataMetadata.compMeta.fsstMetadata()->symbolTable);
+    }
 }
 
 void DictionaryColumn::scan(const ChunkState& offsetState, const ChunkState& dataState,
@@ -81,11 +85,13 @@ void DictionaryColumn::scan(const ChunkState& offsetState, const ChunkState& dat
     scanOffsets(offsetState, offsets.data(), firstOffsetToScan, numOffsetsToScan,
         dataState.metadata.numValues);
 
+    // Reused for the compressed bytes of each FSST string.
+    std::vector<uint8_t> compressedBuffer;
     for (auto pos = 0u; pos < offsetsToScan.size(); pos++) {
         auto startOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan];
         auto endOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan + 1];
         scanValueToVector(dataState, startOffset, endOffset, resultVector,
-            offsetsToScan[pos].second);
+            offsetsToScan[pos].second, compressedBuffer);
         auto& scannedString = resultVector->getValue<ku_string_t>(offsetsToScan[pos].second);
         // For each string which has the same index in the dictionary as the one we scanned,
         // copy the scanned string to its position in the result vector
@@ -99,6 +105,14 @@ void DictionaryColumn::scan(const ChunkState& offsetState, const ChunkState& dat
 
 string_index_t DictionaryColumn::append(const DictionaryChunk& dictChunk, ChunkState& state,
     std::string_view val) {
+    auto& dataMetadata =
+        StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA).metadata;
+    std::vector<uint8_t> compressedVal;
+    if (dataMetadata.compMeta.compression == CompressionType::FSST) {
+        dataMetadata.compMeta.fsstMetadata()->symbolTable.compress(val, compressedVal);
+        val = std::string_view(reinterpret_cast<const char*>(compressedVal.data()),
+            compressedVal.size());
+    }
     const auto startOffset = dataColumn->appendValues(*dictChunk.getStringDataChunk(),
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA),
         reinterpret_cast<const uint8_t*>(val.data()), nullptr /*nullChunkData*/, val.size());
@@ -121,8 +135,25 @@ void DictionaryColumn::scanOffsets(const ChunkState& state,
 }
 
 void DictionaryColumn::scanValueToVector(const ChunkState& dataState, uint64_t startOffset,
-    uint64_t endOffset, ValueVector* resultVector, uint64_t offsetInVector) const {
+    uint64_t endOffset, ValueVector* resultVector, uint64_t offsetInVector,
+    std::vector<uint8_t>& compressedBuffer) const {
     KU_ASSERT(endOffset >= startOffset);
+    if (dataState.metadata.compMeta.compression == CompressionType::FSST) {
+        // Only the bytes of this string are read and decompressed.
+        auto& symbolTable = dataState.metadata.compMeta.fsstMetadata()->symbolTable;
+        const auto compressedSize = endOffset - startOffset;
+        if (compressedBuffer.size() < compressedSize) {
+            compressedBuffer.resize(compressedSize);
+        }
+        dataColumn->scan(dataState, startOffset, endOffset, compressedBuffer.data());
+        auto& kuString = StringVector::reserveString(resultVector, offsetInVector,
+            symbolTable.getDecompressedLength(compressedBuffer.data(), compressedSize));
+        symbolTable.decompress(compressedBuffer.data(), compressedSize, kuString.getDataUnsafe());
+        if (!ku_string_t::isShortString(kuString.len)) {
+            memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
+        }
+        return;
+    }
     // Add string to vector first and read directly into the vector
     auto& kuString =
         StringVector::reserveString(resultVector, offsetInVector, endOffset - startOffset);
@@ -135,6 +166,11 @@ void DictionaryColumn::scanValueToVector(const ChunkState& dataState, uint64_t s
 
 bool DictionaryColumn::canCommitInPlace(const ChunkState& state, uint64_t numNewStrings,
     uint64_t totalStringLengthToAdd) const {
+    if (StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA)
+            .metadata.compMeta.compression == CompressionType::FSST) {
+        // In the worst case every byte of the new strings is escaped.
+        totalStringLengthToAdd *= 2;
+    }
     if (!canDataCommitInPlace(
             StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA),
             totalStringLengthToAdd)) {
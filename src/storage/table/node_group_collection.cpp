@@ -1,6 +1,11 @@
 #include "storage/table/node_group_collection.h"
 
+#include <atomic>
+
+#include "common/task_system/task_scheduler.h"
 #include "common/vector/value_vector.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
 #include "storage/table/csr_node_group.h"
 #include "storage/table/table.h"
 #include "transaction/transaction.h"
@@ -198,13 +203,53 @@ uint64_t NodeGroupCollection::getEstimatedMemoryUsage() const {
     return estimatedMemUsage;
 }
 
+// Checkpoints node groups in parallel. Workers grab one node group at a time, and each worker
+// keeps its own copy of the checkpoint state, as CSR node groups store their headers in it.
+class NodeGroupCheckpointTask final : public Task {
+public:
+    NodeGroupCheckpointTask(uint64_t maxNumThreads, MemoryManager& memoryManager,
+        const NodeGroupCheckpointState& state,
+        const std::vector<std::unique_ptr<NodeGroup>>& nodeGroups)
+        : Task{maxNumThreads}, memoryManager{memoryManager}, state{state}, nodeGroups{nodeGroups},
+          nextNodeGroupIdx{0} {}
+
+    void run() override {
+        const auto localState = state.copy();
+        while (true) {
+            const auto nodeGroupIdx = nextNodeGroupIdx.fetch_add(1);
+            if (nodeGroupIdx >= nodeGroups.size()) {
+                break;
+            }
+            nodeGroups[nodeGroupIdx]->checkpoint(memoryManager, *localState);
+        }
+    }
+
+private:
+    MemoryManager& memoryManager;
+    const NodeGroupCheckpointState& state;
+    const std::vector<std::unique_ptr<NodeGroup>>& nodeGroups;
+    std::atomic<node_group_idx_t> nextNodeGroupIdx;
+};
+
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
-void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
+void NodeGroupCollection::checkpoint(main::ClientContext* context, MemoryManager& memoryManager,
     NodeGroupCheckpointState& state) {
     KU_ASSERT(residency == ResidencyState::ON_DISK);
     const auto lock = nodeGroups.lock();
-    for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
-        nodeGroup->checkpoint(memoryManager, state);
+    const auto& groups = nodeGroups.getAllGroups(lock);
+    const auto numThreads = std::min<uint64_t>(context->getMaxNumThreadForExec(), groups.size());
+    if (numThreads <= 1) {
+        for (const auto& nodeGroup : groups) {
+            nodeGroup->checkpoint(memoryManager, state);
+        }
+    } else {
+        auto task =
+            std::make_shared<NodeGroupCheckpointTask>(numThreads, memoryManager, state, groups);
+        processor::ExecutionContext executionContext{nullptr, context, 0 /*queryID*/};
+        // Checkpoint can be triggered from a worker thread, so launch a new thread to make sure
+        // the task makes progress.
+        context->getTaskScheduler()->scheduleTaskAndWaitOrError(task, &executionContext,
+            true /* launchNewWorkerThread */);
     }
     std::vector<LogicalType> typesAfterCheckpoint;
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
@@ -664,9 +664,12 @@ bool NodeTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tabl
             checkpointColumnPtrs.push_back(column.get());
         }
 
+        for (auto& index : indexes) {
+            index.prepareCheckpoint(context);
+        }
         NodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator,
             memoryManager};
-        nodeGroups->checkpoint(*memoryManager, state);
+        nodeGroups->checkpoint(context, *memoryManager, state);
         for (auto& index : indexes) {
             index.checkpoint(context, pageAllocator);
         }
@@ -699,6 +702,11 @@ void NodeTable::rollbackCheckpoint() {
 void NodeTable::reclaimStorage(PageAllocator& pageAllocator) const {
     nodeGroups->reclaimStorage(pageAllocator);
     getPKIndex()->reclaimStorage(pageAllocator);
+    for (auto& index : indexes) {
+        if (index.isLoaded()) {
+            index.getIndex()->reclaimStorage(pageAllocator);
+        }
+    }
 }
 
 TableStats NodeTable::getStats(const Transaction* transaction) const {
@@ -242,8 +242,8 @@ void RelTableData::pushInsertInfo(const Transaction* transaction, const CSRNodeG
         getVersionRecordHandler(source), shouldIncrementNumRows);
 }
 
-void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
-    PageAllocator& pageAllocator) {
+void RelTableData::checkpoint(main::ClientContext* context,
+    const std::vector<column_id_t>& columnIDs, PageAllocator& pageAllocator) {
     std::vector<std::unique_ptr<Column>> checkpointColumns;
     for (auto i = 0u; i < columnIDs.size(); i++) {
         const auto columnID = columnIDs[i];
@@ -258,7 +258,7 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
 
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator, mm,
         csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
-    nodeGroups->checkpoint(*mm, state);
+    nodeGroups->checkpoint(context, *mm, state);
 }
 
 void RelTableData::serialize(Serializer& serializer) const {
@@ -51,7 +51,9 @@ std::unique_ptr<ColumnChunkData> StringColumn::flushChunkData(const ColumnChunkD
     auto& stringChunk = chunkData.cast<StringChunkData>();
     flushedStringData.setIndexChunk(
         Column::flushChunkData(*stringChunk.getIndexColumnChunk(), pageAllocator));
-    auto& dictChunk = stringChunk.getDictionaryChunk();
+    auto compressedDictChunk = stringChunk.getDictionaryChunk().compressWithFSST();
+    auto& dictChunk =
+        compressedDictChunk ? *compressedDictChunk : stringChunk.getDictionaryChunk();
     flushedStringData.getDictionaryChunk().setOffsetChunk(
         Column::flushChunkData(*dictChunk.getOffsetChunk(), pageAllocator));
     flushedStringData.getDictionaryChunk().setStringDataChunk(
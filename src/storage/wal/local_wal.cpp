@@ -18,11 +18,6 @@ LocalWAL::LocalWAL(MemoryManager& mm) {
     serializer = std::make_unique<Serializer>(writer);
 }
 
-void LocalWAL::logBeginTransaction() {
-    BeginTransactionRecord walRecord;
-    addNewWALRecord(walRecord);
-}
-
 void LocalWAL::logCommit() {
     CommitRecord walRecord;
     addNewWALRecord(walRecord);
@@ -104,6 +99,12 @@ uint64_t LocalWAL::getSize() {
 void LocalWAL::addNewWALRecord(const WALRecord& walRecord) {
     std::unique_lock lck{mtx};
     KU_ASSERT(walRecord.type != WALRecordType::INVALID_RECORD);
+    if (writer->getSize() == 0) {
+        // The begin record is only logged with the first change, so that transactions without
+        // changes leave the local WAL empty and don't need to be logged and synced.
+        KU_ASSERT(walRecord.type != WALRecordType::COMMIT_RECORD);
+        BeginTransactionRecord{}.serialize(*serializer);
+    }
     walRecord.serialize(*serializer);
 }
 
@@ -15,37 +15,83 @@ namespace storage {
 
 WAL::WAL(const std::string& dbPath, bool readOnly, VirtualFileSystem* vfs)
     : walPath{StorageUtils::getWALFilePath(dbPath)},
-      inMemory{main::DBConfig::isDBPathInMemory(dbPath)}, readOnly{readOnly}, vfs{vfs} {}
+      inMemory{main::DBConfig::isDBPathInMemory(dbPath)}, readOnly{readOnly}, vfs{vfs},
+      lastCommitSeq{0}, lastSyncedCommitSeq{0}, isSyncing{false} {}
 
 WAL::~WAL() {}
 
-void WAL::logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context) {
+uint64_t WAL::logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context) {
     KU_ASSERT(!readOnly);
     if (inMemory || localWAL.getSize() == 0) {
-        return; // No need to log empty WAL.
+        return 0; // No need to log empty WAL.
     }
     std::unique_lock lck{mtx};
     initWriter(context);
     localWAL.writer->flush(*writer);
-    flushAndSyncNoLock();
+    return ++lastCommitSeq;
+}
+
+void WAL::syncCommittedWAL(uint64_t commitSeq, main::ClientContext* context) {
+    std::unique_lock lck{mtx};
+    while (lastSyncedCommitSeq < commitSeq) {
+        if (isSyncing) {
+            // The leader's sync may not cover this commit, in which case we check again.
+            syncCV.wait(lck);
+            continue;
+        }
+        isSyncing = true;
+        const auto dbConfig = context->getDBConfig();
+        if (dbConfig->enableMultiWrites && dbConfig->groupCommitDelayInMicros > 0) {
+            // Releases the lock so that concurrent committers can append to this group.
+            syncCV.wait_for(lck, std::chrono::microseconds(dbConfig->groupCommitDelayInMicros));
+        }
+        // Flush and snapshot the last commit under the lock. Commits appended after the lock is
+        // released are written past the flushed offset, and are only covered by the next sync.
+        const auto syncedCommitSeq = lastCommitSeq;
+        try {
+            writer->flush();
+            // Sync the file rather than the writer, whose buffer and offsets concurrent appends may
+            // change. The file can't be reset or cleared while syncing.
+            auto& fileToSync = *fileInfo;
+            lck.unlock();
+            fileToSync.syncFile();
+            lck.lock();
+        } catch (...) {
+            if (!lck.owns_lock()) {
+                lck.lock();
+            }
+            isSyncing = false;
+            syncCV.notify_all();
+            throw;
+        }
+        lastSyncedCommitSeq = std::max(lastSyncedCommitSeq, syncedCommitSeq);
+        isSyncing = false;
+        syncCV.notify_all();
+    }
 }
 
 void WAL::logAndFlushCheckpoint(main::ClientContext* context) {
     std::unique_lock lck{mtx};
+    waitForSyncNoLock(lck);
     initWriter(context);
     CheckpointRecord walRecord;
     addNewWALRecordNoLock(walRecord);
     flushAndSyncNoLock();
+    // The checkpoint record is synced after all appended commits, so they are all durable now.
+    lastSyncedCommitSeq = lastCommitSeq;
+    syncCV.notify_all();
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): semantically non-const function.
 void WAL::clear() {
     std::unique_lock lck{mtx};
+    waitForSyncNoLock(lck);
     writer->clear();
 }
 
 void WAL::reset() {
     std::unique_lock lck{mtx};
+    waitForSyncNoLock(lck);
     fileInfo.reset();
     writer.reset();
     serializer.reset();
@@ -58,9 +104,14 @@ void WAL::flushAndSyncNoLock() {
     writer->sync();
 }
 
+void WAL::waitForSyncNoLock(std::unique_lock<std::mutex>& lck) {
+    syncCV.wait(lck, [&] { return !isSyncing; });
+}
+
 uint64_t WAL::getFileSize() {
     std::unique_lock lck{mtx};
-    return writer->getSize();
+    // The writer is reset by checkpoints, and only created again by the next commit.
+    return writer ? writer->getSize() : 0;
 }
 
 void WAL::initWriter(main::ClientContext* context) {
@@ -1,5 +1,11 @@
 #include "storage/wal/wal_replayer.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <unordered_map>
+
 #include "binder/binder.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
@@ -9,10 +15,13 @@
 #include "common/file_system/file_system.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/serializer/buffered_file.h"
+#include "common/task_system/task_scheduler.h"
 #include "extension/extension_manager.h"
 #include "main/client_context.h"
+#include "processor/execution_context.h"
 #include "processor/expression_mapper.h"
 #include "storage/local_storage/local_rel_table.h"
+#include "storage/local_storage/local_storage.h"
 #include "storage/storage_manager.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
@@ -28,6 +37,126 @@ using namespace kuzu::transaction;
 namespace kuzu {
 namespace storage {
 
+// Maximum number of consecutive table records replayed together.
+static constexpr uint64_t MAX_NUM_TABLE_RECORDS_PER_BATCH = 1024;
+
+// Deserializes WAL records up to the given offset. With pipelining, records are deserialized by a
+// separate thread while the previous ones are replayed, keeping at most MAX_NUM_BUFFERED_RECORDS
+// records in memory.
+class WALRecordReader {
+    static constexpr uint64_t MAX_NUM_BUFFERED_RECORDS = 64;
+
+public:
+    WALRecordReader(FileInfo& fileInfo, uint64_t endOffset,
+        const main::ClientContext& clientContext, bool pipelined)
+        : deserializer{std::make_unique<BufferedFileReader>(fileInfo)}, endOffset{endOffset},
+          clientContext{clientContext}, pipelined{pipelined}, finished{false}, stopped{false} {
+        if (pipelined) {
+            thread = std::thread([this]() { readRecords(); });
+        }
+    }
+    DELETE_COPY_AND_MOVE(WALRecordReader);
+    ~WALRecordReader() {
+        if (pipelined) {
+            {
+                std::unique_lock lck{mtx};
+                stopped = true;
+            }
+            cv.notify_all();
+            thread.join();
+        }
+    }
+
+    // Returns nullptr once all records are read.
+    std::unique_ptr<WALRecord> next() {
+        if (!pipelined) {
+            return hasNextRecord() ? WALRecord::deserialize(deserializer, clientContext) : nullptr;
+        }
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return !records.empty() || finished; });
+        if (records.empty()) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return nullptr;
+        }
+        auto record = std::move(records.front());
+        records.pop_front();
+        lck.unlock();
+        cv.notify_all();
+        return record;
+    }
+
+private:
+    bool hasNextRecord() const {
+        return deserializer.getReader()->cast<BufferedFileReader>()->getReadOffset() < endOffset;
+    }
+
+    void readRecords() {
+        try {
+            while (hasNextRecord()) {
+                KU_ASSERT(!deserializer.finished());
+                auto record = WALRecord::deserialize(deserializer, clientContext);
+                std::unique_lock lck{mtx};
+                cv.wait(lck, [&] { return records.size() < MAX_NUM_BUFFERED_RECORDS || stopped; });
+                if (stopped) {
+                    return;
+                }
+                records.push_back(std::move(record));
+                lck.unlock();
+                cv.notify_all();
+            }
+        } catch (...) {
+            std::unique_lock lck{mtx};
+            exception = std::current_exception();
+        }
+        {
+            std::unique_lock lck{mtx};
+            finished = true;
+        }
+        cv.notify_all();
+    }
+
+private:
+    Deserializer deserializer;
+    uint64_t endOffset;
+    const main::ClientContext& clientContext;
+    bool pipelined;
+    std::thread thread;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<WALRecord>> records;
+    bool finished;
+    bool stopped;
+    std::exception_ptr exception;
+};
+
+class WALTableReplayTask final : public Task {
+public:
+    WALTableReplayTask(uint64_t maxNumThreads,
+        std::vector<std::vector<WALRecord*>> recordsPerTable,
+        std::function<void(WALRecord&)> replayFunc)
+        : Task{maxNumThreads}, recordsPerTable{std::move(recordsPerTable)},
+          replayFunc{std::move(replayFunc)}, nextTableIdx{0} {}
+
+    void run() override {
+        while (true) {
+            const auto tableIdx = nextTableIdx.fetch_add(1);
+            if (tableIdx >= recordsPerTable.size()) {
+                break;
+            }
+            for (const auto record : recordsPerTable[tableIdx]) {
+                replayFunc(*record);
+            }
+        }
+    }
+
+private:
+    std::vector<std::vector<WALRecord*>> recordsPerTable;
+    std::function<void(WALRecord&)> replayFunc;
+    std::atomic<idx_t> nextTableIdx;
+};
+
 WALReplayer::WALReplayer(main::ClientContext& clientContext) : clientContext{clientContext} {
     walPath = StorageUtils::getWALFilePath(clientContext.getDatabasePath());
     shadowFilePath = StorageUtils::getShadowFilePath(clientContext.getDatabasePath());
@@ -72,13 +201,25 @@ void WALReplayer::replay() const {
             // Read the checkpointed data from the disk.
             checkpointer.readCheckpoint();
             // Resume by replaying the WAL file from the beginning until the last COMMIT record.
-            Deserializer deserializer(std::make_unique<BufferedFileReader>(*fileInfo));
-            while (deserializer.getReader()->cast<BufferedFileReader>()->getReadOffset() <
-                   offsetDeserialized) {
-                KU_ASSERT(!deserializer.finished());
-                auto walRecord = WALRecord::deserialize(deserializer, clientContext);
+            // Consecutive table records are batched, and all other records are replayed on their
+            // own after the pending batch.
+            WALRecordReader reader(*fileInfo, offsetDeserialized, clientContext,
+                clientContext.getMaxNumThreadForExec() > 1 /* pipelined */);
+            std::vector<std::unique_ptr<WALRecord>> tableRecords;
+            while (auto walRecord = reader.next()) {
+                if (canReplayInParallel(*walRecord)) {
+                    tableRecords.push_back(std::move(walRecord));
+                    if (tableRecords.size() == MAX_NUM_TABLE_RECORDS_PER_BATCH) {
+                        replayTableRecords(tableRecords);
+                        tableRecords.clear();
+                    }
+                    continue;
+                }
+                replayTableRecords(tableRecords);
+                tableRecords.clear();
                 replayWALRecord(*walRecord);
             }
+            replayTableRecords(tableRecords);
             // After replaying all the records, we should truncate the WAL file to the last
             // COMMIT/CHECKPOINT record.
             truncateWALFile(*fileInfo, offsetDeserialized);
@@ -184,6 +325,74 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord) const {
     }
 }
 
+static table_id_t getTableID(const WALRecord& walRecord) {
+    switch (walRecord.type) {
+    case WALRecordType::TABLE_INSERTION_RECORD: {
+        return walRecord.constCast<TableInsertionRecord>().tableID;
+    }
+    case WALRecordType::NODE_DELETION_RECORD: {
+        return walRecord.constCast<NodeDeletionRecord>().tableID;
+    }
+    case WALRecordType::NODE_UPDATE_RECORD: {
+        return walRecord.constCast<NodeUpdateRecord>().tableID;
+    }
+    case WALRecordType::REL_DELETION_RECORD: {
+        return walRecord.constCast<RelDeletionRecord>().tableID;
+    }
+    case WALRecordType::REL_DETACH_DELETE_RECORD: {
+        return walRecord.constCast<RelDetachDeleteRecord>().tableID;
+    }
+    case WALRecordType::REL_UPDATE_RECORD: {
+        return walRecord.constCast<RelUpdateRecord>().tableID;
+    }
+    default: {
+        return INVALID_TABLE_ID;
+    }
+    }
+}
+
+bool WALReplayer::canReplayInParallel(const WALRecord& walRecord) const {
+    const auto tableID = getTableID(walRecord);
+    if (tableID == INVALID_TABLE_ID) {
+        return false;
+    }
+    auto table = clientContext.getStorageManager()->getTable(tableID);
+    // Secondary indexes may be backed by other tables.
+    return table->getTableType() == TableType::REL ||
+           table->cast<NodeTable>().getIndexes().size() == 1;
+}
+
+void WALReplayer::replayTableRecords(
+    const std::vector<std::unique_ptr<WALRecord>>& walRecords) const {
+    std::vector<std::vector<WALRecord*>> recordsPerTable;
+    std::unordered_map<table_id_t, idx_t> tableIdxes;
+    for (auto& walRecord : walRecords) {
+        const auto tableID = getTableID(*walRecord);
+        if (!tableIdxes.contains(tableID)) {
+            tableIdxes[tableID] = recordsPerTable.size();
+            recordsPerTable.emplace_back();
+        }
+        // Local tables are created upfront, so workers only look them up.
+        if (walRecord->type == WALRecordType::TABLE_INSERTION_RECORD) {
+            clientContext.getTransaction()->getLocalStorage()->getOrCreateLocalTable(
+                *clientContext.getStorageManager()->getTable(tableID));
+        }
+        recordsPerTable[tableIdxes.at(tableID)].push_back(walRecord.get());
+    }
+    const auto numThreads =
+        std::min<uint64_t>(clientContext.getMaxNumThreadForExec(), recordsPerTable.size());
+    if (numThreads <= 1) {
+        for (auto& walRecord : walRecords) {
+            replayWALRecord(*walRecord);
+        }
+        return;
+    }
+    auto task = std::make_shared<WALTableReplayTask>(numThreads, std::move(recordsPerTable),
+        [this](WALRecord& walRecord) { replayWALRecord(walRecord); });
+    processor::ExecutionContext executionContext{nullptr, &clientContext, 0 /*queryID*/};
+    clientContext.getTaskScheduler()->scheduleTaskAndWaitOrError(task, &executionContext);
+}
+
 void WALReplayer::replayCreateCatalogEntryRecord(WALRecord& walRecord) const {
     auto catalog = clientContext.getCatalog();
     auto transaction = clientContext.getTransaction();
@@ -58,19 +58,21 @@ bool Transaction::shouldForceCheckpoint() const {
     return !clientContext->isInMemory() && forceCheckpoint;
 }
 
-void Transaction::commit(storage::WAL* wal) {
+uint64_t Transaction::commit(storage::WAL* wal) {
     localStorage->commit();
     undoBuffer->commit(commitTS);
-    if (shouldLogToWAL()) {
-        KU_ASSERT(localWAL && wal);
+    uint64_t commitSeq = 0;
+    if (shouldLogToWAL() && localWAL->getSize() > 0) {
+        KU_ASSERT(wal);
         localWAL->logCommit();
-        wal->logCommittedWAL(*localWAL, clientContext);
+        commitSeq = wal->logCommittedWAL(*localWAL, clientContext);
         localWAL->clear();
     }
     if (hasCatalogChanges) {
         clientContext->getCatalog()->incrementVersion();
         hasCatalogChanges = false;
     }
+    return commitSeq;
 }
 
 void Transaction::rollback(storage::WAL*) {
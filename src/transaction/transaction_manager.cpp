@@ -20,6 +20,9 @@ Transaction* TransactionManager::beginTransaction(main::ClientContext& clientCon
     // We acquire the lock for starting new transactions. In case this cannot be acquired, this
     // ensures calls to other public functions are not restricted.
     std::unique_lock publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+    if (type != TransactionType::RECOVERY) {
+        waitForOverdueCheckpointNoLock(clientContext, publicFunctionLck);
+    }
     std::unique_lock newTransactionLck{mtxForStartingNewTransactions};
     switch (type) {
     case TransactionType::READ_ONLY: {
@@ -37,9 +40,6 @@ Transaction* TransactionManager::beginTransaction(main::ClientContext& clientCon
         }
         auto transaction =
             std::make_unique<Transaction>(clientContext, type, ++lastTransactionID, lastTimestamp);
-        if (transaction->shouldLogToWAL()) {
-            transaction->getLocalWAL().logBeginTransaction();
-        }
         activeTransactions.push_back(std::move(transaction));
         return activeTransactions.back().get();
     }
@@ -57,17 +57,39 @@ void TransactionManager::commit(main::ClientContext& clientContext, Transaction*
     switch (transaction->getType()) {
     case TransactionType::READ_ONLY: {
         clearTransactionNoLock(transaction->getID());
+        // A read-only transaction has nothing to do with the checkpoint, so it succeeds even if the
+        // checkpoint fails.
+        tryRunPendingCheckpointNoLock(clientContext);
     } break;
     case TransactionType::RECOVERY:
     case TransactionType::WRITE: {
         lastTimestamp++;
         transaction->commitTS = lastTimestamp;
-        transaction->commit(&wal);
-        auto shouldCheckpoint = transaction->shouldForceCheckpoint() ||
-                                Checkpointer::canAutoCheckpoint(clientContext, *transaction);
+        const auto commitSeq = transaction->commit(&wal);
+        auto shouldForceCheckpoint = transaction->shouldForceCheckpoint();
+        auto shouldAutoCheckpoint = Checkpointer::canAutoCheckpoint(clientContext, *transaction);
         clearTransactionNoLock(transaction->getID());
-        if (shouldCheckpoint) {
+        // A commit without changes logs nothing to the WAL, so there is nothing to sync.
+        if (commitSeq > 0) {
+            if (clientContext.getDBConfig()->enableMultiWrites && !shouldForceCheckpoint) {
+                // Wait for the WAL sync without blocking other committers, so that concurrent
+                // commits can be synced together.
+                lck.unlock();
+                wal.syncCommittedWAL(commitSeq, &clientContext);
+                lck.lock();
+            } else {
+                wal.syncCommittedWAL(commitSeq, &clientContext);
+            }
+        }
+        if (shouldForceCheckpoint) {
             checkpointNoLock(clientContext);
+        } else {
+            // Changes of the committed transaction are already in the WAL, so the auto checkpoint
+            // can be deferred until the other transactions leave instead of blocking new ones.
+            if (shouldAutoCheckpoint) {
+                setPendingCheckpointNoLock();
+            }
+            runPendingCheckpointNoLock(clientContext);
         }
     } break;
         // LCOV_EXCL_START
@@ -97,6 +119,9 @@ void TransactionManager::rollback(main::ClientContext& clientContext, Transactio
         throw TransactionManagerException("Invalid transaction type to rollback.");
     }
     }
+    // The rolled back transaction may be the last one the pending checkpoint waits for. Failing
+    // the checkpoint must not fail the rollback.
+    tryRunPendingCheckpointNoLock(clientContext);
 }
 
 void TransactionManager::checkpoint(main::ClientContext& clientContext) {
@@ -172,6 +197,61 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
         checkpointer->rollback();
         throw CheckpointException{e};
     }
+    hasPendingCheckpoint = false;
+}
+
+void TransactionManager::runPendingCheckpointNoLock(main::ClientContext& clientContext) {
+    if (!hasPendingCheckpoint || !hasNoActiveTransactions()) {
+        return;
+    }
+    checkpointNoLock(clientContext);
+}
+
+void TransactionManager::tryRunPendingCheckpointNoLock(main::ClientContext& clientContext) {
+    try {
+        runPendingCheckpointNoLock(clientContext);
+    } catch (CheckpointException&) {
+        // The checkpoint is rolled back and stays pending.
+    }
+}
+
+void TransactionManager::setPendingCheckpointNoLock() {
+    if (hasPendingCheckpoint) {
+        return;
+    }
+    hasPendingCheckpoint = true;
+    pendingCheckpointStartTime = std::chrono::steady_clock::now();
+    pendingCheckpointWALSize = wal.getFileSize();
+}
+
+bool TransactionManager::isPendingCheckpointOverdueNoLock(
+    const main::ClientContext& clientContext) {
+    if (!hasPendingCheckpoint) {
+        return false;
+    }
+    if (std::chrono::steady_clock::now() - pendingCheckpointStartTime >=
+        std::chrono::microseconds(MAX_PENDING_CHECKPOINT_AGE_IN_MICROS)) {
+        return true;
+    }
+    return wal.getFileSize() >
+           pendingCheckpointWALSize + clientContext.getDBConfig()->checkpointThreshold;
+}
+
+void TransactionManager::waitForOverdueCheckpointNoLock(const main::ClientContext& clientContext,
+    std::unique_lock<std::mutex>& publicFunctionLck) {
+    uint64_t numTimesWaited = 0;
+    while (!hasNoActiveTransactions() && isPendingCheckpointOverdueNoLock(clientContext)) {
+        if (numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
+            checkpointWaitTimeoutInMicros) {
+            // Start the transaction anyway instead of failing it because of long-running ones.
+            return;
+        }
+        numTimesWaited++;
+        publicFunctionLck.unlock();
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+        publicFunctionLck.lock();
+    }
 }
 
 } // namespace transaction
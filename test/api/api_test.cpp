@@ -12,6 +12,7 @@
 
 #include "api_test/api_test.h"
 #include "common/exception/io.h"
+#include "common/exception/runtime.h"
 
 using namespace kuzu::common;
 using namespace kuzu::main;
@@ -65,6 +66,22 @@ TEST_F(ApiTest, ParallelConnect) {
     }
 }
 
+// Many connections issuing short queries at the same time, which is the workload the task
+// scheduler's per-worker queues are meant for.
+TEST_F(ApiTest, ParallelQueryManyConnections) {
+    const auto numThreads = 64u;
+    std::thread threads[numThreads];
+    for (auto i = 0u; i < numThreads; ++i) {
+        threads[i] = std::thread([&] {
+            auto conn = std::make_unique<Connection>(database.get());
+            parallel_query(conn.get());
+        });
+    }
+    for (auto i = 0u; i < numThreads; ++i) {
+        threads[i].join();
+    }
+}
+
 static void executeLongRunningQuery(Connection* conn) {
     auto result = conn->query(
         "UNWIND RANGE(1,100000) AS x UNWIND RANGE(1, 100000) AS y RETURN COUNT(x + y);");
@@ -162,6 +179,39 @@ TEST_F(ApiTest, MultipleQuery) {
     ASSERT_EQ(result->getNextQueryResult()->toString(), "3\n3\n");
 }
 
+TEST_F(ApiTest, StreamingResults) {
+    ASSERT_TRUE(conn->query("CALL enable_streaming_results=true")->isSuccess());
+    auto result = conn->query("UNWIND range(1, 10000) AS i RETURN i");
+    ASSERT_TRUE(result->isSuccess());
+    auto expected = 1;
+    while (result->hasNext()) {
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), expected++);
+        if (expected == 3000) {
+            // Running another query materializes the rest of the streamed result.
+            assertMatchPersonCountStar(conn.get());
+        }
+    }
+    ASSERT_EQ(expected, 10001);
+    ASSERT_EQ(result->getNumTuples(), 10000);
+    ASSERT_THROW(result->resetIterator(), RuntimeException);
+
+    result = conn->query("MATCH (a:person)-[:knows]->(b:person) WHERE a.ID < b.ID RETURN a.ID, "
+                         "b.ID ORDER BY a.ID, b.ID");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNumTuples(), 8);
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->toString(), "0|2\n");
+    result->resetIterator();
+    ASSERT_EQ(result->getNext()->toString(), "0|2\n");
+
+    // Dropping a partially consumed result finishes its transaction.
+    result = conn->query("UNWIND range(1, 10000) AS i RETURN i");
+    ASSERT_TRUE(result->hasNext());
+    result.reset();
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE Test(id INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL enable_streaming_results=false")->isSuccess());
+}
+
 TEST_F(ApiTest, SingleQueryHasNextQueryResult) {
     auto result = conn->query("MATCH (a:person) RETURN a.fName;");
     ASSERT_TRUE(result->isSuccess());
@@ -26,3 +26,98 @@ TEST_F(ArrowTest, getArrowSchema) {
     ASSERT_EQ(std::string(schema->children[0]->name), "NAME");
     schema->release(schema.get());
 }
+
+// Checks that the arrow chunks of a query hold the same values as reading it tuple by tuple.
+// Columns must be INT64, DOUBLE, BOOL or STRING.
+static void checkArrowChunksMatchTuples(kuzu::main::Connection& conn, const std::string& query,
+    int64_t chunkSize, uint64_t numTuplesToSkip = 0) {
+    auto expectedResult = conn.query(query);
+    ASSERT_TRUE(expectedResult->isSuccess()) << expectedResult->getErrorMessage();
+    std::vector<std::vector<Value>> expectedTuples;
+    while (expectedResult->hasNext()) {
+        auto tuple = expectedResult->getNext();
+        std::vector<Value> values;
+        for (auto i = 0u; i < tuple->len(); i++) {
+            values.push_back(*tuple->getValue(i));
+        }
+        expectedTuples.push_back(std::move(values));
+    }
+    auto result = conn.query(query);
+    for (auto i = 0u; i < numTuplesToSkip; i++) {
+        ASSERT_TRUE(result->hasNext());
+        result->getNext();
+    }
+    auto types = result->getColumnDataTypes();
+    auto tupleIdx = numTuplesToSkip;
+    while (true) {
+        auto arrowArray = result->getNextArrowChunk(chunkSize);
+        ASSERT_LE(arrowArray->length, chunkSize);
+        if (arrowArray->length == 0) {
+            arrowArray->release(arrowArray.get());
+            break;
+        }
+        for (auto col = 0u; col < types.size(); col++) {
+            auto child = arrowArray->children[col];
+            ASSERT_EQ(child->length, arrowArray->length);
+            auto validity = (const uint8_t*)child->buffers[0];
+            for (auto row = 0; row < arrowArray->length; row++) {
+                auto& expected = expectedTuples[tupleIdx + row][col];
+                auto isValid = (validity[row / 8] >> (row % 8)) & 1;
+                ASSERT_EQ(!isValid, expected.isNull());
+                if (expected.isNull()) {
+                    continue;
+                }
+                switch (types[col].getLogicalTypeID()) {
+                case LogicalTypeID::INT64: {
+                    ASSERT_EQ(((const int64_t*)child->buffers[1])[row],
+                        expected.getValue<int64_t>());
+                } break;
+                case LogicalTypeID::DOUBLE: {
+                    ASSERT_EQ(((const double*)child->buffers[1])[row], expected.getValue<double>());
+                } break;
+                case LogicalTypeID::BOOL: {
+                    auto data = (const uint8_t*)child->buffers[1];
+                    ASSERT_EQ((bool)((data[row / 8] >> (row % 8)) & 1), expected.getValue<bool>());
+                } break;
+                case LogicalTypeID::STRING: {
+                    auto offsets = (const uint32_t*)child->buffers[1];
+                    auto str = std::string((const char*)child->buffers[2] + offsets[row],
+                        offsets[row + 1] - offsets[row]);
+                    ASSERT_EQ(str, expected.getValue<std::string>());
+                } break;
+                default:
+                    FAIL() << "Unexpected column type " << types[col].toString();
+                }
+            }
+        }
+        tupleIdx += arrowArray->length;
+        arrowArray->release(arrowArray.get());
+    }
+    ASSERT_EQ(tupleIdx, expectedTuples.size());
+}
+
+TEST_F(ArrowTest, getArrowChunksFromUnflatColumns) {
+    auto query = "MATCH (a:person) RETURN a.ID, a.eyeSight, a.isStudent, a.fName, "
+                 "CASE WHEN a.ID % 3 = 0 THEN NULL ELSE a.age END";
+    checkArrowChunksMatchTuples(*conn, query, 3);
+    checkArrowChunksMatchTuples(*conn, query, 1000);
+    checkArrowChunksMatchTuples(*conn, query, 2, 3 /* numTuplesToSkip */);
+}
+
+TEST_F(ArrowTest, getArrowChunksFromFlatAndUnflatColumns) {
+    auto query = "MATCH (a:person)-[:knows]->(b:person) RETURN a.ID, a.fName, b.ID, b.fName, "
+                 "CASE WHEN b.ID % 2 = 0 THEN NULL ELSE b.age END";
+    checkArrowChunksMatchTuples(*conn, query, 5);
+    checkArrowChunksMatchTuples(*conn, query, 4, 1 /* numTuplesToSkip */);
+}
+
+TEST_F(ArrowTest, getArrowChunksFromFlatColumns) {
+    auto query = "MATCH (a:person) RETURN a.ID, a.fName, a.age ORDER BY a.ID";
+    checkArrowChunksMatchTuples(*conn, query, 3);
+    checkArrowChunksMatchTuples(*conn, query, 3, 2 /* numTuplesToSkip */);
+}
+
+TEST_F(ArrowTest, getArrowChunksFromCrossProduct) {
+    auto query = "MATCH (a:person), (b:person) RETURN a.ID, b.fName";
+    checkArrowChunksMatchTuples(*conn, query, 7);
+}
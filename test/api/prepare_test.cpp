@@ -1,6 +1,10 @@
+#include <chrono>
+#include <thread>
+
 #include "api_test/api_test.h"
 
 using namespace kuzu::common;
+using namespace kuzu::main;
 using namespace kuzu::testing;
 
 static void checkTuple(kuzu::processor::FlatTuple* tuple, const std::string& groundTruth) {
@@ -254,3 +258,70 @@ TEST_F(ApiTest, ParameterWith) {
     auto groupTruth = std::vector<std::string>{"abc"};
     ASSERT_EQ(groupTruth, TestHelper::convertResultToString(*result));
 }
+
+TEST_F(ApiTest, PlanCache) {
+    ASSERT_TRUE(conn->query("CALL plan_cache_size=16")->isSuccess());
+    auto query = std::string("MATCH (a:person) WHERE a.fName STARTS WITH $n RETURN a.ID, a.fName");
+    // Prepare and execute the same template from a new connection each time. Queries differing
+    // only in formatting share plans.
+    for (auto i = 0u; i < 3; i++) {
+        auto connection = std::make_unique<Connection>(database.get());
+        auto preparedStatement = connection->prepare(i == 1 ? "  " + query + "\n;" : query);
+        ASSERT_TRUE(preparedStatement->isSuccess());
+        auto result =
+            connection->execute(preparedStatement.get(), std::make_pair(std::string("n"), "A"));
+        ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"0|Alice"});
+    }
+    // The prepared and the executed plan are both cached.
+    auto result = conn->query("CALL plan_cache_info() RETURN *");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"2|4|3"});
+    // Plans are cached per parameter type, and executed with the new parameter values.
+    auto preparedStatement = conn->prepare(query);
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), "B"));
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"2|Bob"});
+    result = conn->query("CALL plan_cache_info() RETURN num_hits, num_misses");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"6|4"});
+    // Changing the catalog invalidates cached plans.
+    ASSERT_TRUE(conn->query("ALTER TABLE person ADD nickname STRING")->isSuccess());
+    preparedStatement = conn->prepare(query);
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), "B"));
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"2|Bob"});
+    result = conn->query("CALL plan_cache_info() RETURN num_hits, num_misses");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"6|8"});
+    ASSERT_TRUE(conn->query("CALL plan_cache_size=0")->isSuccess());
+}
+
+TEST_F(ApiTest, PlanCacheFoldedParameter) {
+    ASSERT_TRUE(conn->query("CALL plan_cache_size=16")->isSuccess());
+    // The limit is folded into the plan, so plans bound with another limit are not reused.
+    auto preparedStatement = conn->prepare("MATCH (a:person) RETURN a.ID ORDER BY a.ID LIMIT $n");
+    ASSERT_TRUE(preparedStatement->isSuccess());
+    for (auto n : {1, 2, 2, 1}) {
+        auto result =
+            conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), int64_t(n)));
+        ASSERT_TRUE(result->isSuccess());
+        ASSERT_EQ(result->getNumTuples(), n);
+    }
+    auto result = conn->query("CALL plan_cache_info() RETURN num_hits");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"1"});
+    ASSERT_TRUE(conn->query("CALL plan_cache_size=0")->isSuccess());
+}
+
+TEST_F(ApiTest, PlanCacheVolatileFunction) {
+    ASSERT_TRUE(conn->query("CALL plan_cache_size=16")->isSuccess());
+    // Volatile functions are not folded at bind time, so each run of a cached plan evaluates them
+    // again.
+    auto query = std::string("RETURN current_timestamp() AS t, gen_random_uuid() AS u");
+    auto first = TestHelper::convertResultToString(*conn->query(query));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto second = TestHelper::convertResultToString(*conn->query(query));
+    ASSERT_EQ(first.size(), 1);
+    ASSERT_EQ(second.size(), 1);
+    auto result = conn->query("CALL plan_cache_info() RETURN num_hits");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"1"});
+    auto firstTimestamp = first[0].substr(0, first[0].find('|'));
+    auto secondTimestamp = second[0].substr(0, second[0].find('|'));
+    ASSERT_NE(firstTimestamp, secondTimestamp);
+    ASSERT_NE(first[0].substr(first[0].find('|')), second[0].substr(second[0].find('|')));
+    ASSERT_TRUE(conn->query("CALL plan_cache_size=0")->isSuccess());
+}
@@ -0,0 +1,84 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "api_test/api_test.h"
+#include "common/task_system/task_scheduler.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::testing;
+
+#ifndef __SINGLE_THREADED__
+// Each thread running the task waits until numThreadsToWaitFor threads have entered it, or until
+// a deadline passes so that a scheduler failing to hand out the task does not hang the test.
+class BarrierTask : public Task {
+public:
+    BarrierTask(uint64_t maxNumThreads, uint64_t numThreadsToWaitFor)
+        : Task{maxNumThreads}, numThreadsToWaitFor{numThreadsToWaitFor}, numThreadsEntered{0} {}
+
+    void run() override {
+        numThreadsEntered++;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (numThreadsEntered.load() < numThreadsToWaitFor &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+
+    uint64_t getNumThreadsEntered() const { return numThreadsEntered.load(); }
+
+private:
+    uint64_t numThreadsToWaitFor;
+    std::atomic<uint64_t> numThreadsEntered;
+};
+
+class CountingTask : public Task {
+public:
+    CountingTask(uint64_t maxNumThreads, std::atomic<uint64_t>& numRuns)
+        : Task{maxNumThreads}, numRuns{numRuns} {}
+
+    void run() override { numRuns++; }
+
+private:
+    std::atomic<uint64_t>& numRuns;
+};
+
+TEST_F(ApiTest, TaskSchedulerWorkStealing) {
+    const auto numWorkers = 4u;
+    TaskScheduler scheduler{numWorkers};
+    ExecutionContext context{nullptr, conn->getClientContext(), 0 /* queryID */};
+    // The task is pushed into a single worker's queue, so all but one of the workers can only
+    // join it by stealing it from that queue.
+    auto task = std::make_shared<BarrierTask>(numWorkers, numWorkers);
+    scheduler.scheduleTaskAndWaitOrError(task, &context);
+    ASSERT_EQ(task->getNumThreadsEntered(), numWorkers);
+}
+
+TEST_F(ApiTest, TaskSchedulerMoreTasksThanWorkers) {
+    const auto numWorkers = 2u;
+    const auto numSchedulingThreads = 16u;
+    const auto numTasksPerThread = 200u;
+    TaskScheduler scheduler{numWorkers};
+    std::atomic<uint64_t> numRuns{0};
+    std::vector<std::thread> threads;
+    for (auto i = 0u; i < numSchedulingThreads; ++i) {
+        threads.emplace_back([&, i] {
+            ExecutionContext context{nullptr, conn->getClientContext(), i /* queryID */};
+            for (auto j = 0u; j < numTasksPerThread; ++j) {
+                // Alternate between single-threaded tasks and tasks accepting more threads than
+                // there are workers, so that workers go idle and are woken up repeatedly.
+                const auto maxNumThreads = j % 2 == 0 ? 1 : numWorkers * 2;
+                auto task = std::make_shared<CountingTask>(maxNumThreads, numRuns);
+                scheduler.scheduleTaskAndWaitOrError(task, &context);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // Every task ran at least once, and none ran on more threads than it accepts.
+    ASSERT_GE(numRuns.load(), numSchedulingThreads * numTasksPerThread);
+    ASSERT_LE(numRuns.load(), numSchedulingThreads * numTasksPerThread / 2 * (1 + numWorkers));
+}
+#endif
@@ -31,6 +31,7 @@ enum class ResultType {
     CSV_FILE,
     ERROR_MSG,
     ERROR_REGEX,
+    CONTAINS,
 };
 
 struct TestQueryResult {
@@ -45,7 +45,29 @@ TEST_F(CardinalityTest, TestOperators) {
         EXPECT_EQ(planner::LogicalOperatorType::SCAN_NODE_TABLE, source->getOperatorType());
         EXPECT_EQ(8, source->getCardinality());
         EXPECT_EQ(planner::LogicalOperatorType::FILTER, parent->getOperatorType());
-        EXPECT_EQ(4, parent->getCardinality());
+        EXPECT_EQ(3, parent->getCardinality());
+    }
+
+    // Filter estimated from most common values
+    {
+        auto plan = getRoot("EXPLAIN LOGICAL MATCH (p1: person) WHERE p1.gender > 1 RETURN p1.ID");
+        auto [parent, source] = getSource(plan->getLastOperator().get());
+        EXPECT_EQ(planner::LogicalOperatorType::FILTER, parent->getOperatorType());
+        EXPECT_EQ(5, parent->getCardinality());
+    }
+    {
+        auto plan =
+            getRoot("EXPLAIN LOGICAL MATCH (p1: person) WHERE 1 >= p1.gender RETURN p1.ID");
+        auto [parent, source] = getSource(plan->getLastOperator().get());
+        EXPECT_EQ(planner::LogicalOperatorType::FILTER, parent->getOperatorType());
+        EXPECT_EQ(3, parent->getCardinality());
+    }
+    {
+        auto plan =
+            getRoot("EXPLAIN LOGICAL MATCH (p1: person) WHERE p1.gender IN [1, 2] RETURN p1.ID");
+        auto [parent, source] = getSource(plan->getLastOperator().get());
+        EXPECT_EQ(planner::LogicalOperatorType::FILTER, parent->getOperatorType());
+        EXPECT_EQ(8, parent->getCardinality());
     }
 
     // Limit
@@ -255,6 +255,13 @@ private:
                     newFile += currLine + '\n';
                 }
             } break;
+            // Expects the output to contain the given text.
+            // -STATEMENT EXPLAIN MATCH (p:person) RETURN p.ID;
+            // ---- contains
+            // SCAN_NODE_TABLE
+            case ResultType::CONTAINS: {
+                newFile += currLine + '\n' + skipExistingOutput(file);
+            } break;
             }
         }
         // Append any remaining lines in the file.
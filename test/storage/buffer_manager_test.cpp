@@ -1,4 +1,5 @@
 #include <cstdint>
+#include <cstring>
 
 #include "common/constants.h"
 #include "common/system_config.h"
@@ -30,6 +31,8 @@ public:
         // Can't use UINT64_MAX since it will overflow the usedMemory
         ASSERT_FALSE(bm->reserve(UINT64_MAX / 2));
     }
+    bool reserve(uint64_t size) { return getBufferManager(*database)->reserve(size); }
+    void freeUsedMemory(uint64_t size) { getBufferManager(*database)->freeUsedMemory(size); }
 };
 
 TEST_F(BufferManagerTest, TestBMUsageForIdenticalQueries) {
@@ -115,6 +118,53 @@ TEST_F(EmptyBufferManagerTest, TestSpillToDiskMemoryUsage) {
     }
 }
 
+TEST_F(EmptyBufferManagerTest, TestCachedBlockReuse) {
+    auto bm = getBufferManager(*database);
+    auto mm = getMemoryManager(*database);
+    mm->releaseCachedBlocks();
+    auto initialUsedMemory = bm->getUsedMemory();
+    uint8_t* data = nullptr;
+    {
+        auto buffer = mm->allocateBuffer(false, MemoryManager::MIN_CACHED_BLOCK_SIZE);
+        ASSERT_EQ(initialUsedMemory + MemoryManager::MIN_CACHED_BLOCK_SIZE, bm->getUsedMemory());
+        data = buffer->getData();
+        std::memset(data, 1, MemoryManager::MIN_CACHED_BLOCK_SIZE);
+    }
+    // The freed block is cached and stays accounted as used memory.
+    ASSERT_EQ(initialUsedMemory + MemoryManager::MIN_CACHED_BLOCK_SIZE, bm->getUsedMemory());
+    {
+        auto buffer = mm->allocateBuffer(true, MemoryManager::MIN_CACHED_BLOCK_SIZE);
+        ASSERT_EQ(data, buffer->getData());
+        ASSERT_EQ(initialUsedMemory + MemoryManager::MIN_CACHED_BLOCK_SIZE, bm->getUsedMemory());
+        for (auto i = 0u; i < MemoryManager::MIN_CACHED_BLOCK_SIZE; i++) {
+            ASSERT_EQ(data[i], 0);
+        }
+    }
+    ASSERT_EQ(mm->releaseCachedBlocks(), MemoryManager::MIN_CACHED_BLOCK_SIZE);
+    ASSERT_EQ(initialUsedMemory, bm->getUsedMemory());
+}
+
+TEST_F(BufferManagerTest, TestCachedBlocksReleasedWhenPinning) {
+    auto bm = getBufferManager(*database);
+    auto mm = getMemoryManager(*database);
+    // Evict all pages, so that cached blocks are the only memory that can be freed.
+    reserveAll();
+    mm->releaseCachedBlocks();
+    {
+        // The freed block is cached and stays accounted as used memory.
+        auto buffer = mm->allocateBuffer(false, MemoryManager::MAX_CACHED_BLOCK_SIZE);
+    }
+    const auto remainingMemory = bm->getMemoryLimit() - bm->getUsedMemory();
+    ASSERT_TRUE(reserve(remainingMemory));
+    {
+        // Pinning a page of the temp file frees the cached block.
+        auto buffer = mm->allocateBuffer(false, TEMP_PAGE_SIZE);
+        ASSERT_NE(buffer->getData(), nullptr);
+        ASSERT_EQ(mm->releaseCachedBlocks(), 0);
+    }
+    freeUsedMemory(remainingMemory);
+}
+
 // Simulates the case where we try to evict a page during an optimistic read
 TEST_F(BufferManagerTest, TestBMEvictionSlowRead) {
     if (inMemMode) {
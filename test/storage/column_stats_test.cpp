@@ -0,0 +1,76 @@
+#include "common/data_chunk/data_chunk_state.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/buffer_writer.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "gtest/gtest.h"
+#include "storage/stats/column_stats.h"
+#include "storage/storage_version_info.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+static void updateWithRange(ColumnStats& stats, int64_t start, int64_t numValues) {
+    ValueVector vector{LogicalType::INT64()};
+    vector.state = std::make_shared<DataChunkState>();
+    vector.state->initOriginalAndSelectedSize(numValues);
+    for (auto i = 0; i < numValues; i++) {
+        vector.setValue<int64_t>(i, start + i);
+    }
+    stats.update(&vector);
+}
+
+TEST(ColumnStatsTests, SampleSerializeThenDeserialize) {
+    ColumnStats stats{LogicalType::INT64()};
+    updateWithRange(stats, 0, 100);
+    const auto writer = std::make_shared<BufferWriter>();
+    Serializer ser{writer};
+    stats.serialize(ser);
+
+    Deserializer deSer{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
+    const auto deserialized = ColumnStats::deserialize(deSer);
+    EXPECT_TRUE(deSer.finished());
+    EXPECT_EQ(deserialized.getNumDistinctValues(), stats.getNumDistinctValues());
+    ASSERT_NE(deserialized.getHistogram(), nullptr);
+    EXPECT_DOUBLE_EQ(deserialized.getHistogram()->estimateRangeSelectivity(50, true,
+                         std::nullopt, false),
+        stats.getHistogram()->estimateRangeSelectivity(50, true, std::nullopt, false));
+}
+
+TEST(ColumnStatsTests, DeserializeWithoutSample) {
+    // Column stats before COLUMN_SAMPLE_STORAGE_VERSION end after the HLL.
+    const auto writer = std::make_shared<BufferWriter>();
+    Serializer ser{writer};
+    ser.writeDebuggingInfo("has_hll");
+    ser.serializeValue(true);
+    ser.writeDebuggingInfo("hll");
+    HyperLogLog{}.serialize(ser);
+
+    Deserializer deSer{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
+    deSer.setStorageVersion(StorageVersionInfo::COLUMN_SAMPLE_STORAGE_VERSION - 1);
+    auto stats = ColumnStats::deserialize(deSer);
+    EXPECT_TRUE(deSer.finished());
+    EXPECT_EQ(stats.getHistogram(), nullptr);
+    updateWithRange(stats, 0, 100);
+    EXPECT_EQ(stats.getHistogram(), nullptr);
+}
+
+TEST(ColumnStatsTests, HistogramIsCachedUntilSampleChanges) {
+    ColumnStats stats{LogicalType::INT64()};
+    EXPECT_EQ(stats.getHistogram(), nullptr);
+    updateWithRange(stats, 0, 100);
+    const auto histogram = stats.getHistogram();
+    ASSERT_NE(histogram, nullptr);
+    EXPECT_EQ(stats.getHistogram(), histogram);
+    // Copies share the histogram built for the same sample.
+    const auto copy = stats.copy();
+    EXPECT_EQ(copy.getHistogram(), histogram);
+    EXPECT_NEAR(histogram->estimateRangeSelectivity(std::nullopt, false, 100, false), 1, 1e-9);
+
+    updateWithRange(stats, 100, 100);
+    const auto newHistogram = stats.getHistogram();
+    ASSERT_NE(newHistogram, nullptr);
+    EXPECT_NE(newHistogram, histogram);
+    EXPECT_LT(newHistogram->estimateRangeSelectivity(std::nullopt, false, 100, false), 0.9);
+    EXPECT_EQ(copy.getHistogram(), histogram);
+}
@@ -597,3 +597,120 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+template<DeltaBitpackingType T>
+void deltaPackingMultiPage(const std::vector<T>& src, uint8_t expectedBitWidth) {
+    auto alg = DeltaBitpacking<T>();
+    auto pageSize = 4096;
+    const auto& [min, max] = std::minmax_element(src.begin(), src.end());
+    auto metadata =
+        DeltaBitpacking<T>::getMetadata(src, StorageValue(*min), StorageValue(*max));
+    EXPECT_EQ(DeltaBitpacking<T>::getBitWidth(metadata), expectedBitWidth);
+    testSerializeThenDeserialize(metadata);
+    auto numValuesPerPage = DeltaBitpacking<T>::numValues(pageSize, metadata);
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        alg.compressNextPage(srcCursor, numValuesRemaining, dest[pageNum++].data(), pageSize,
+            metadata);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    for (auto i = 0u; i < src.size(); i += 97) {
+        auto page = i / numValuesPerPage;
+        auto indexInPage = i % numValuesPerPage;
+        T value;
+        alg.decompressFromPage(dest[page].data(), indexInPage, (uint8_t*)&value, 0, 1 /*numValues*/,
+            metadata);
+        EXPECT_EQ(src[i], value);
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), metadata);
+    }
+    ASSERT_EQ(decompressed, src);
+    // Decompress part of the first page
+    auto numValuesInFirstPage = std::min(numValuesPerPage, (uint64_t)src.size());
+    decompressed.clear();
+    decompressed.resize(numValuesInFirstPage / 2);
+    alg.decompressFromPage(dest[0].data(), numValuesInFirstPage / 3, (uint8_t*)decompressed.data(),
+        0, numValuesInFirstPage / 2, metadata);
+    ASSERT_TRUE(std::equal(decompressed.begin(), decompressed.end(),
+        src.begin() + numValuesInFirstPage / 3));
+    // Decompress the first page in small consecutive parts, as a scan does
+    decompressed.assign(numValuesInFirstPage, 0);
+    for (auto i = 0u; i < numValuesInFirstPage; i += 100) {
+        alg.decompressFromPage(dest[0].data(), i, (uint8_t*)decompressed.data(), i,
+            std::min<uint64_t>(100, numValuesInFirstPage - i), metadata);
+    }
+    ASSERT_TRUE(std::equal(decompressed.begin(), decompressed.end(), src.begin()));
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageSortedUnsigned64) {
+    int64_t numValues = 100000;
+    std::vector<uint64_t> src(numValues);
+    uint64_t offset = 1ull << 40;
+    for (int i = 0; i < numValues; i++) {
+        src[i] = offset;
+        offset += i % 7;
+    }
+
+    deltaPackingMultiPage(src, 3);
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageDecreasing32) {
+    int64_t numValues = 10000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 1000000 - i * 100 - i % 3;
+    }
+
+    deltaPackingMultiPage(src, 2);
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageConstantDifference) {
+    int64_t numValues = 100000;
+    std::vector<uint32_t> src(numValues);
+    std::iota(src.begin(), src.end(), 1000);
+
+    deltaPackingMultiPage(src, 0);
+}
+
+// Differences which overflow wrap around
+TEST(CompressionTests, DeltaPackingMultiPageOverflow64) {
+    int64_t numValues = 1000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i % 2 == 0 ? std::numeric_limits<int64_t>::min() + i :
+                              std::numeric_limits<int64_t>::max() - i;
+    }
+
+    deltaPackingMultiPage(src, 12);
+}
+
+TEST(CompressionTests, DeltaPackingMultiPageWrapAroundUnsigned32) {
+    int64_t numValues = 10000;
+    std::vector<uint32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = std::numeric_limits<uint32_t>::max() - 1000 + i * 3;
+    }
+
+    deltaPackingMultiPage(src, 0);
+}
+
+TEST(CompressionTests, DeltaPackingCannotUpdateInPlace) {
+    std::vector<int64_t> src{1, 2, 3, 4};
+    auto metadata = DeltaBitpacking<int64_t>::getMetadata(src, StorageValue(1), StorageValue(4));
+    kuzu::storage::InPlaceUpdateLocalState localUpdateState{};
+    int64_t value = 2;
+    EXPECT_FALSE(metadata.canAlwaysUpdateInPlace());
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)&value, 0, 1, PhysicalTypeID::INT64,
+        localUpdateState));
+    EXPECT_EQ(metadata.toString(PhysicalTypeID::INT64), "DELTA_BITPACKING[0]");
+}
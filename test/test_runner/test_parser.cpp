@@ -199,6 +199,10 @@ TestQueryResult TestParser::extractExpectedResultFromToken() {
         queryResult.type = ResultType::ERROR_REGEX;
         queryResult.expectedResult.push_back(extractTextBeforeNextStatement());
         replaceVariables(queryResult.expectedResult[0]);
+    } else if (result == "contains") {
+        queryResult.type = ResultType::CONTAINS;
+        queryResult.expectedResult.push_back(extractTextBeforeNextStatement());
+        replaceVariables(queryResult.expectedResult[0]);
     } else if (result.substr(0, 4) == "hash") {
         queryResult.type = ResultType::HASH;
         checkMinimumParams(1);
@@ -128,6 +128,14 @@ void TestRunner::checkLogicalPlan(Connection& conn, QueryResult* queryResult,
             << "Expected error to match regex: " << testAnswer.expectedResult[0]
             << " actual error: " << actualError;
     } break;
+    case ResultType::CONTAINS: {
+        ASSERT_TRUE(queryResult->isSuccess())
+            << "Unexpected error for query: " << queryResult->getErrorMessage();
+        const auto actualResult = queryResult->toString();
+        ASSERT_NE(actualResult.find(testAnswer.expectedResult[0]), std::string::npos)
+            << "Expected result to contain: " << testAnswer.expectedResult[0]
+            << " actual result: " << actualResult;
+    } break;
     default: {
         ASSERT_TRUE(queryResult->isSuccess())
             << "Unexpected error for query: " << queryResult->getErrorMessage();
@@ -256,6 +264,9 @@ void TestRunner::generateOutput(QueryResult* result, TestStatement* statement, s
             "---- " + (result->isSuccess() ? std::string("ok") : std::string("error(regex)")) +
             '\n';
     } break;
+    case ResultType::CONTAINS: {
+        statement->newOutput += "---- contains\n" + testAnswer.expectedResult[0] + '\n';
+    } break;
     }
 }
 
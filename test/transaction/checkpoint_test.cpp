@@ -1,3 +1,5 @@
+#include <thread>
+
 #include "api_test/private_api_test.h"
 #include "common/exception/runtime.h"
 #include "storage/checkpointer.h"
@@ -225,5 +227,57 @@ TEST_F(FlakyCheckpointerTest, RecoverFromCheckpointClearingFilesFailure) {
     runTest(flakyCheckpointer);
 }
 
+static void deferCheckpointBehindReadOnlyTransaction(main::Connection& conn,
+    main::Connection& readConn) {
+    conn.query("CALL force_checkpoint_on_close=false;");
+    conn.query("CALL auto_checkpoint=true");
+    conn.query("CALL checkpoint_threshold=0");
+    conn.query("CREATE NODE TABLE test(id INT64 PRIMARY KEY, name STRING);");
+    ASSERT_TRUE(readConn.query("BEGIN TRANSACTION READ ONLY;")->isSuccess());
+    // The auto checkpoint of this commit is deferred until the reader leaves.
+    ASSERT_TRUE(conn.query("CREATE (a:test {id: 0, name: 'name_0'});")->isSuccess());
+}
+
+TEST_F(FlakyCheckpointerTest, PendingCheckpointFailureNotReportedByReadOnlyCommit) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    auto readConn = std::make_unique<main::Connection>(database.get());
+    deferCheckpointBehindReadOnlyTransaction(*conn, *readConn);
+    auto initFlakyCheckpointer = [](main::ClientContext& context) {
+        return std::make_unique<FlakyCheckpointerFailsOnCheckpointStorage>(context);
+    };
+    FlakyCheckpointer flakyCheckpointer(initFlakyCheckpointer);
+    flakyCheckpointer.setCheckpointer(*getClientContext(*conn));
+    ASSERT_TRUE(readConn->query("COMMIT;")->isSuccess());
+    ASSERT_TRUE(readConn->query("BEGIN TRANSACTION READ ONLY;")->isSuccess());
+    ASSERT_TRUE(readConn->query("ROLLBACK;")->isSuccess());
+    readConn.reset();
+    createDBAndConn();
+    auto res = conn->query("MATCH (a:test) RETURN COUNT(a);");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<int64_t>(), 1);
+}
+
+TEST_F(FlakyCheckpointerTest, OverduePendingCheckpointBlocksNewTransactions) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    auto readConn = std::make_unique<main::Connection>(database.get());
+    deferCheckpointBehindReadOnlyTransaction(*conn, *readConn);
+    // The WAL grows by more than the checkpoint threshold while the checkpoint is pending.
+    ASSERT_TRUE(conn->query("CREATE (a:test {id: 1, name: 'name_1'});")->isSuccess());
+    std::thread reader([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        readConn->query("COMMIT;");
+    });
+    // The transaction of this query only starts after the reader left and the checkpoint ran.
+    auto res = conn->query(
+        "CALL storage_info('test') WHERE residency='IN_MEMORY' RETURN COUNT(*);");
+    reader.join();
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNext()->getValue(0)->getValue<int64_t>(), 0);
+}
+
 } // namespace testing
 } // namespace kuzu
@@ -1,4 +1,5 @@
 #include <fstream>
+#include <thread>
 
 #include "api_test/api_test.h"
 #include "api_test/private_api_test.h"
@@ -355,3 +356,74 @@ TEST_F(WalTest, ReadOnlyRecoveryNoWALFile) {
     ASSERT_TRUE(res->isSuccess());
     ASSERT_EQ(res->getNumTuples(), 0);
 }
+
+TEST_F(WalTest, EmptyTransactionNotLogged) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    conn->query("CALL auto_checkpoint=false");
+    conn->query("CALL force_checkpoint_on_close=false");
+    conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY);");
+    auto walFilePath = kuzu::storage::StorageUtils::getWALFilePath(databasePath);
+    const auto walFileSize = std::filesystem::file_size(walFilePath);
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION;")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (t:test) RETURN COUNT(*);")->isSuccess());
+    ASSERT_TRUE(conn->query("COMMIT;")->isSuccess());
+    ASSERT_EQ(std::filesystem::file_size(walFilePath), walFileSize);
+}
+
+// Concurrent writers commit through group syncs. Every commit that returned must be recovered from
+// a copy of the files taken without closing the database, and the recovered commits of each
+// writer must be a prefix of its commits.
+TEST_F(WalTest, ConcurrentCommitsDurableInOrder) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    static constexpr auto numWriters = 4;
+    static constexpr auto numCommits = 50;
+    conn->query("CALL debug_enable_multi_writes=true");
+    conn->query("CALL group_commit_delay=100");
+    conn->query("CALL auto_checkpoint=false");
+    conn->query("CALL force_checkpoint_on_close=false");
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY, writer INT64, seq INT64);")
+            ->isSuccess());
+    // Checkpoint so that the database file is not written while copying it.
+    ASSERT_TRUE(conn->query("CHECKPOINT;")->isSuccess());
+    std::vector<std::thread> writers;
+    std::atomic<bool> failed{false};
+    for (auto writer = 0; writer < numWriters; writer++) {
+        writers.emplace_back([&, writer]() {
+            kuzu::main::Connection writerConn(database.get());
+            for (auto seq = 0; seq < numCommits; seq++) {
+                const auto id = writer * numCommits + seq;
+                const auto res = writerConn.query(
+                    stringFormat("CREATE (:test {id: {}, writer: {}, seq: {}});", id, writer, seq));
+                if (!res->isSuccess()) {
+                    failed = true;
+                    return;
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    ASSERT_FALSE(failed);
+    auto copyPath = databasePath + "_copy";
+    std::filesystem::copy_file(databasePath, copyPath);
+    std::filesystem::copy_file(kuzu::storage::StorageUtils::getWALFilePath(databasePath),
+        kuzu::storage::StorageUtils::getWALFilePath(copyPath));
+    auto copyDB = std::make_unique<kuzu::main::Database>(copyPath, *systemConfig);
+    kuzu::main::Connection copyConn(copyDB.get());
+    auto res = copyConn.query("MATCH (t:test) RETURN t.writer, COUNT(*), MAX(t.seq) ORDER BY "
+                              "t.writer;");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNumTuples(), numWriters);
+    for (auto writer = 0; writer < numWriters; writer++) {
+        auto tuple = res->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), writer);
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), numCommits);
+        ASSERT_EQ(tuple->getValue(2)->getValue<int64_t>(), numCommits - 1);
+    }
+}